@@ -89,6 +89,19 @@ Defined if built as static libraries. Default are shared libraries.
 #define MAGNUM_BUILD_STATIC
 #undef MAGNUM_BUILD_STATIC
 
+/**
+@brief SIMD math
+
+Defined if the @ref Math library uses SSE2 (on x86) or NEON (on 64-bit ARM)
+for arithmetic on four-component float vectors, 4x4 float matrix
+multiplication and float quaternion multiplication. The results are
+bit-exact with the scalar implementation. If the target doesn't support any
+of the instruction sets, the scalar implementation is used.
+@see @ref building
+*/
+#define MAGNUM_MATH_SIMD
+#undef MAGNUM_MATH_SIMD
+
 /**
 @brief OpenGL ES target
 
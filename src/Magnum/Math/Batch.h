@@ -0,0 +1,342 @@
+#ifndef Magnum_Math_Batch_h
+#define Magnum_Math_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::StridedArrayReference, batch functions @ref Magnum::Math::transformPoints(), @ref Magnum::Math::transformVectors(), @ref Magnum::Math::normalize(), @ref Magnum::Math::dot(), @ref Magnum::Math::lerp(), @ref Magnum::Math::slerp(), @ref Magnum::Math::multiply(), @ref Magnum::Math::multiplyAccumulate(), @ref Magnum::Math::min(), @ref Magnum::Math::max(), @ref Magnum::Math::minmax()
+ */
+
+#include <type_traits>
+#include <utility>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Strided array reference
+
+Non-owning reference to array of values which are not necessarily
+contiguous, for example one attribute in interleaved vertex data. Used by the
+batch functions in this header, which process whole arrays instead of single
+values. Example usage:
+@code
+struct Vertex {
+    Vector3 position;
+    Vector2 textureCoordinates;
+};
+std::vector<Vertex> vertices;
+
+Math::StridedArrayReference<Vector3> positions{&vertices[0].position, vertices.size(), sizeof(Vertex)};
+Math::transformPoints(transformation, positions, positions);
+@endcode
+*/
+template<class T> class StridedArrayReference {
+    template<class> friend class StridedArrayReference;
+
+    public:
+        /** @brief Element type */
+        typedef T Type;
+
+        /** @brief Default constructor, creates empty reference */
+        constexpr /*implicit*/ StridedArrayReference(): _data{}, _size{}, _stride{sizeof(T)} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to first element
+         * @param size      Element count
+         * @param stride    Distance between two elements in bytes
+         */
+        constexpr /*implicit*/ StridedArrayReference(T* data, std::size_t size, std::size_t stride = sizeof(T)): _data{data}, _size{size}, _stride{stride} {}
+
+        /** @brief Construct reference to contiguous fixed-size array */
+        template<std::size_t size> constexpr /*implicit*/ StridedArrayReference(T(&data)[size]): _data{data}, _size{size}, _stride{sizeof(T)} {}
+
+        /** @brief Construct const reference from non-const one */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> constexpr /*implicit*/ StridedArrayReference(const StridedArrayReference<U>& other): _data{other._data}, _size{other._size}, _stride{other._stride} {}
+
+        /** @brief Pointer to first element */
+        constexpr T* data() const { return _data; }
+
+        /** @brief Element count */
+        constexpr std::size_t size() const { return _size; }
+
+        /** @brief Whether the reference is empty */
+        constexpr bool empty() const { return !_size; }
+
+        /** @brief Distance between two elements in bytes */
+        constexpr std::size_t stride() const { return _stride; }
+
+        /** @brief Whether the elements are contiguous */
+        constexpr bool isContiguous() const { return _stride == sizeof(T); }
+
+        /** @brief Element at given position */
+        T& operator[](std::size_t i) const {
+            return *reinterpret_cast<T*>(reinterpret_cast<typename std::conditional<std::is_const<T>::value, const char, char>::type*>(_data) + i*_stride);
+        }
+
+    private:
+        T* _data;
+        std::size_t _size;
+        std::size_t _stride;
+};
+
+namespace Implementation {
+
+/* The matrix coefficients are copied into locals so the compiler can keep
+   them in registers, as it can't prove that the matrix doesn't alias the
+   data. All three input components are read before writing, so the input and
+   output can be the same. With compile-time stride the compiler is able to
+   vectorize the loop. */
+template<bool translate, std::size_t fixedStride, class T> void transformBatch(const Matrix4<T>& matrix, const char* const in, const std::size_t runtimeInStride, char* const out, const std::size_t runtimeOutStride, const std::size_t count) {
+    const std::size_t inStride = fixedStride ? fixedStride : runtimeInStride;
+    const std::size_t outStride = fixedStride ? fixedStride : runtimeOutStride;
+    const T m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2],
+            m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2],
+            m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2],
+            m30 = translate ? matrix[3][0] : T(0),
+            m31 = translate ? matrix[3][1] : T(0),
+            m32 = translate ? matrix[3][2] : T(0);
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const T* const v = reinterpret_cast<const T*>(in + i*inStride);
+        const T x = v[0], y = v[1], z = v[2];
+        T* const o = reinterpret_cast<T*>(out + i*outStride);
+        o[0] = m00*x + m10*y + m20*z + m30;
+        o[1] = m01*x + m11*y + m21*z + m31;
+        o[2] = m02*x + m12*y + m22*z + m32;
+    }
+}
+
+template<bool translate, class T, class U, class V> void transformBatch(const Matrix4<T>& matrix, const StridedArrayReference<U>& in, const StridedArrayReference<V>& out) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, Vector3<T>>::value && std::is_same<V, Vector3<T>>::value,
+        "the arrays must contain three-component vectors of the same type as the matrix");
+    const char* const inData = reinterpret_cast<const char*>(in.data());
+    char* const outData = reinterpret_cast<char*>(out.data());
+    if(in.isContiguous() && out.isContiguous())
+        transformBatch<translate, sizeof(Vector3<T>)>(matrix, inData, 0, outData, 0, in.size());
+    else transformBatch<translate, 0>(matrix, inData, in.stride(), outData, out.stride(), in.size());
+}
+
+}
+
+/**
+@brief Transform array of points
+@param[in] matrix   Transformation matrix
+@param[in] in       Input points
+@param[out] out     Output points, can be the same as @p in
+
+Batch equivalent of @ref Matrix4::transformPoint(). Only the upper 3x4 part
+of the matrix is used. The arrays must have the same size.
+@see @ref transformVectors()
+*/
+template<class T, class U, class V> void transformPoints(const Matrix4<T>& matrix, const StridedArrayReference<U>& in, const StridedArrayReference<V>& out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::transformPoints(): expected arrays of the same size, got" << in.size() << "and" << out.size(), );
+    Implementation::transformBatch<true>(matrix, in, out);
+}
+
+/**
+@brief Transform array of vectors
+@param[in] matrix   Transformation matrix
+@param[in] in       Input vectors
+@param[out] out     Output vectors, can be the same as @p in
+
+Batch equivalent of @ref Matrix4::transformVector(). Only the upper 3x3 part
+of the matrix is used. The arrays must have the same size.
+@see @ref transformPoints()
+*/
+template<class T, class U, class V> void transformVectors(const Matrix4<T>& matrix, const StridedArrayReference<U>& in, const StridedArrayReference<V>& out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::transformVectors(): expected arrays of the same size, got" << in.size() << "and" << out.size(), );
+    Implementation::transformBatch<false>(matrix, in, out);
+}
+
+/**
+@brief Normalize array of vectors
+@param[in] in       Input vectors
+@param[out] out     Output vectors, can be the same as @p in
+
+Batch equivalent of @ref Vector::normalized(). The arrays must have the same
+size.
+*/
+template<class T, class U> void normalize(const StridedArrayReference<T>& in, const StridedArrayReference<U>& out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::normalize(): expected arrays of the same size, got" << in.size() << "and" << out.size(), );
+    for(std::size_t i = 0; i != in.size(); ++i)
+        out[i] = in[i].normalized();
+}
+
+/**
+@brief Dot products of two arrays of vectors
+@param[in] a        First vectors
+@param[in] b        Second vectors
+@param[out] out     Dot product of each pair
+
+Batch equivalent of @ref Vector::dot(). All arrays must have the same size.
+*/
+template<class T, class U, class V> void dot(const StridedArrayReference<T>& a, const StridedArrayReference<U>& b, const StridedArrayReference<V>& out) {
+    typedef typename std::remove_const<T>::type VectorType;
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::dot(): expected input arrays of the same size, got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(out.size() == a.size(),
+        "Math::dot(): expected output array of size" << a.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = VectorType::dot(a[i], b[i]);
+}
+
+/**
+@brief Linear interpolation of two arrays
+@param[in] a        First values
+@param[in] b        Second values
+@param[in] t        Interpolation phase
+@param[out] out     Interpolated values, can be the same as @p a or @p b
+
+Batch equivalent of @ref lerp(const T&, const T&, U). Both input arrays
+and the output array must have the same size.
+@see @ref slerp()
+*/
+template<class T, class U, class V, class W> void lerp(const StridedArrayReference<T>& a, const StridedArrayReference<U>& b, const W t, const StridedArrayReference<V>& out) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::lerp(): expected input arrays of the same size, got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(out.size() == a.size(),
+        "Math::lerp(): expected output array of size" << a.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = lerp(a[i], b[i], t);
+}
+
+/**
+@brief Spherical linear interpolation of two arrays of quaternions
+@param[in] normalizedA  First quaternions
+@param[in] normalizedB  Second quaternions
+@param[in] t            Interpolation phase
+@param[out] out         Interpolated quaternions, can be the same as
+    @p normalizedA or @p normalizedB
+
+Batch equivalent of @ref Quaternion::slerp(). All arrays must have the same
+size.
+@see @ref lerp()
+*/
+template<class T, class U, class V> void slerp(const StridedArrayReference<T>& normalizedA, const StridedArrayReference<U>& normalizedB, const typename std::remove_const<T>::type::Type t, const StridedArrayReference<V>& out) {
+    typedef typename std::remove_const<T>::type QuaternionType;
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size(),
+        "Math::slerp(): expected input arrays of the same size, got" << normalizedA.size() << "and" << normalizedB.size(), );
+    CORRADE_ASSERT(out.size() == normalizedA.size(),
+        "Math::slerp(): expected output array of size" << normalizedA.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        out[i] = QuaternionType::slerp(normalizedA[i], normalizedB[i], t);
+}
+
+/**
+@brief Multiply two arrays
+@param[in] a        First values
+@param[in] b        Second values
+@param[out] out     Product of each pair, can be the same as @p a or @p b
+
+Useful e.g. for concatenating arrays of transformation matrices. All arrays
+must have the same size.
+*/
+template<class T, class U, class V> void multiply(const StridedArrayReference<T>& a, const StridedArrayReference<U>& b, const StridedArrayReference<V>& out) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::multiply(): expected input arrays of the same size, got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(out.size() == a.size(),
+        "Math::multiply(): expected output array of size" << a.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = a[i]*b[i];
+}
+
+/**
+@brief Weighted sum of array
+@param values       Values
+@param weights      Weight for each value
+
+Computes @f$ \sum_i w_i v_i @f$, useful e.g. for blending matrices in linear
+blend skinning. Expects that the arrays are not empty and have the same size.
+*/
+template<class T, class U> typename std::remove_const<T>::type multiplyAccumulate(const StridedArrayReference<T>& values, const StridedArrayReference<U>& weights) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(!values.empty() && values.size() == weights.size(),
+        "Math::multiplyAccumulate(): expected non-empty arrays of the same size, got" << values.size() << "and" << weights.size(), {});
+    Type out = values[0]*weights[0];
+    for(std::size_t i = 1; i != values.size(); ++i)
+        out += values[i]*weights[i];
+    return out;
+}
+
+/**
+@brief Minimum of array
+
+Component-wise for vectors. Expects that the array is not empty.
+@see @ref min(T, T), @ref Vector::min()
+*/
+template<class T> typename std::remove_const<T>::type min(const StridedArrayReference<T>& values) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(!values.empty(), "Math::min(): the array is empty", {});
+    Type out = values[0];
+    for(std::size_t i = 1; i != values.size(); ++i)
+        out = Type(min(out, values[i]));
+    return out;
+}
+
+/**
+@brief Maximum of array
+
+Component-wise for vectors. Expects that the array is not empty.
+@see @ref max(T, T), @ref Vector::max()
+*/
+template<class T> typename std::remove_const<T>::type max(const StridedArrayReference<T>& values) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(!values.empty(), "Math::max(): the array is empty", {});
+    Type out = values[0];
+    for(std::size_t i = 1; i != values.size(); ++i)
+        out = Type(max(out, values[i]));
+    return out;
+}
+
+/**
+@brief Minimum and maximum of array
+
+Component-wise for vectors, done in single pass. Expects that the array is
+not empty.
+@see @ref minmax(T, T), @ref Range::Range(const VectorType&, const VectorType&)
+*/
+template<class T> std::pair<typename std::remove_const<T>::type, typename std::remove_const<T>::type> minmax(const StridedArrayReference<T>& values) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(!values.empty(), "Math::minmax(): the array is empty", {});
+    Type outMin = values[0], outMax = values[0];
+    for(std::size_t i = 1; i != values.size(); ++i) {
+        outMin = Type(min(outMin, values[i]));
+        outMax = Type(max(outMax, values[i]));
+    }
+    return {outMin, outMax};
+}
+
+}}
+
+#endif
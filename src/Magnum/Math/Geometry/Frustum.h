@@ -0,0 +1,139 @@
+#ifndef Magnum_Math_Geometry_Frustum_h
+#define Magnum_Math_Geometry_Frustum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Math::Geometry::Frustum
+ */
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Math { namespace Geometry {
+
+/**
+@brief Camera frustum
+
+Six planes in order left, right, bottom, top, near, far, each stored as
+@f$ (n_x, n_y, n_z, d) @f$ with normal pointing inside the frustum, so point
+**p** is inside the frustum if @f$ \boldsymbol n \cdot \boldsymbol p + d \ge 0 @f$
+for all planes. The planes are normalized, i.e. @f$ d @f$ is signed distance
+of the plane from origin. See @ref Intersection::pointFrustum() and related
+functions for culling tests.
+*/
+template<class T> class Frustum {
+    public:
+        /**
+         * @brief Create frustum from projection matrix
+         *
+         * Extracts the planes from combined projection and view matrix, see
+         * Gribb, Hartmann: *Fast Extraction of Viewing Frustum Planes from
+         * the World-View-Projection Matrix*. If the matrix is just the
+         * projection, the planes are in view space, if it's combined with
+         * camera matrix, the planes are in world space.
+         */
+        static Frustum<T> fromMatrix(const Matrix4<T>& matrix) {
+            const Vector4<T> r0 = matrix.row(0), r1 = matrix.row(1),
+                r2 = matrix.row(2), r3 = matrix.row(3);
+            return {r3 + r0, r3 - r0, r3 + r1, r3 - r1, r3 + r2, r3 - r2};
+        }
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates frustum spanning a cube from @f$ (-1, -1, -1) @f$ to
+         * @f$ (1, 1, 1) @f$, i.e. the same as @ref fromMatrix() with identity
+         * matrix.
+         */
+        constexpr /*implicit*/ Frustum(): _data{
+            { T(1), T(0), T(0), T(1)},
+            {-T(1), T(0), T(0), T(1)},
+            { T(0), T(1), T(0), T(1)},
+            { T(0), -T(1), T(0), T(1)},
+            { T(0), T(0), T(1), T(1)},
+            { T(0), T(0), -T(1), T(1)}} {}
+
+        /**
+         * @brief Construct frustum from planes
+         *
+         * The planes are normalized.
+         */
+        /*implicit*/ Frustum(const Vector4<T>& left, const Vector4<T>& right, const Vector4<T>& bottom, const Vector4<T>& top, const Vector4<T>& near, const Vector4<T>& far): _data{normalizePlane(left), normalizePlane(right), normalizePlane(bottom), normalizePlane(top), normalizePlane(near), normalizePlane(far)} {}
+
+        /** @brief Equality comparison */
+        bool operator==(const Frustum<T>& other) const {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(_data[i] != other._data[i]) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Frustum<T>& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief Plane at given position
+         *
+         * Order is left, right, bottom, top, near, far.
+         */
+        constexpr Vector4<T> operator[](std::size_t i) const { return _data[i]; }
+
+        /**
+         * @brief Raw data
+         * @return One-dimensional array of 24 elements, planes one after
+         *      another
+         */
+        T* data() { return _data[0].data(); }
+        constexpr const T* data() const { return _data[0].data(); } /**< @overload */
+
+    private:
+        static Vector4<T> normalizePlane(const Vector4<T>& plane) {
+            return plane/plane.xyz().length();
+        }
+
+        Vector4<T> _data[6];
+};
+
+/** @debugoperator{Magnum::Math::Geometry::Frustum} */
+template<class T> Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, const Frustum<T>& value) {
+    debug << "Frustum({";
+    debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, false);
+    for(std::size_t i = 0; i != 6; ++i) {
+        if(i != 0) debug << "},\n        {";
+        for(std::size_t j = 0; j != 4; ++j) {
+            if(j != 0) debug << ", ";
+            debug << value[i][j];
+        }
+    }
+    debug << "})";
+    debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, true);
+    return debug;
+}
+
+}}}
+
+#endif
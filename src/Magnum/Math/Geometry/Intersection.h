@@ -29,7 +29,10 @@
  * @brief Class Magnum::Math::Geometry::Intersection
  */
 
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Geometry/Frustum.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
@@ -124,8 +127,170 @@ class Intersection {
             const T f = Vector3<T>::dot(planePosition, planeNormal);
             return (f-Vector3<T>::dot(planeNormal, p))/Vector3<T>::dot(planeNormal, r);
         }
+        /**
+         * @brief %Intersection of a point and frustum
+         * @param point         Point
+         * @param frustum       Frustum planes
+         * @return `true` if the point is inside the frustum, `false`
+         *      otherwise
+         *
+         * Checks that the point is on the inner side of all planes.
+         */
+        template<class T> static bool pointFrustum(const Vector3<T>& point, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(Vector3<T>::dot(frustum[i].xyz(), point) + frustum[i].w() < T(0))
+                    return false;
+            return true;
+        }
+
+        /**
+         * @brief %Intersection of a sphere and frustum
+         * @param center        Sphere center
+         * @param radius        Sphere radius
+         * @param frustum       Frustum planes
+         * @return `true` if the sphere intersects the frustum, `false`
+         *      otherwise
+         *
+         * Conservative, the sphere is considered intersecting also if it's
+         * outside the frustum near its corners. That's usually acceptable
+         * for culling.
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(Vector3<T>::dot(frustum[i].xyz(), center) + frustum[i].w() < -radius)
+                    return false;
+            return true;
+        }
+
+        /**
+         * @brief %Intersection of an axis-aligned box and frustum
+         * @param range         Axis-aligned box
+         * @param frustum       Frustum planes
+         * @return `true` if the box intersects the frustum, `false`
+         *      otherwise
+         *
+         * For each plane the box extents are projected onto the plane normal
+         * and the box is rejected if the whole projection is on the outer
+         * side. Conservative in the same way as @ref sphereFrustum().
+         */
+        template<class T> static bool rangeFrustum(const Range3D<T>& range, const Frustum<T>& frustum) {
+            const Vector3<T> center = range.min() + range.max();
+            const Vector3<T> extent = range.max() - range.min();
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector3<T> normal = frustum[i].xyz();
+                /* Both center and extent are doubled, so is the plane
+                   distance */
+                if(Vector3<T>::dot(normal, center) + T(2)*frustum[i].w() < -Vector3<T>::dot(Math::abs(normal), extent))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief %Intersection of an oriented box and frustum
+         * @param box           Box transformation
+         * @param frustum       Frustum planes
+         * @return `true` if the box intersects the frustum, `false`
+         *      otherwise
+         *
+         * The box is unit-size (i.e. with half-extents equal to 1) cube
+         * transformed with @p box, the same as @ref Shapes::Box. Conservative
+         * in the same way as @ref sphereFrustum().
+         */
+        template<class T> static bool boxFrustum(const Matrix4<T>& box, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector3<T> normal = frustum[i].xyz();
+                const T radius = std::abs(Vector3<T>::dot(normal, box.right())) +
+                                 std::abs(Vector3<T>::dot(normal, box.up())) +
+                                 std::abs(Vector3<T>::dot(normal, box.backward()));
+                if(Vector3<T>::dot(normal, box.translation()) + frustum[i].w() < -radius)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief %Intersection of array of spheres and frustum
+         * @param[in] centers   Sphere centers
+         * @param[in] radii     Sphere radii
+         * @param[in] frustum   Frustum planes
+         * @param[out] visible  Whether given sphere intersects the frustum
+         *
+         * Batch version of @ref sphereFrustum(const Vector3<T>&, T, const Frustum<T>&).
+         * All arrays must have the same size.
+         */
+        template<class T> static void sphereFrustum(const StridedArrayReference<const Vector3<T>>& centers, const StridedArrayReference<const T>& radii, const Frustum<T>& frustum, const StridedArrayReference<bool>& visible);
+
+        /**
+         * @brief %Intersection of array of axis-aligned boxes and frustum
+         * @param[in] ranges    Axis-aligned boxes
+         * @param[in] frustum   Frustum planes
+         * @param[out] visible  Whether given box intersects the frustum
+         *
+         * Batch version of @ref rangeFrustum(const Range3D<T>&, const Frustum<T>&).
+         * The arrays must have the same size.
+         */
+        template<class T> static void rangeFrustum(const StridedArrayReference<const Range3D<T>>& ranges, const Frustum<T>& frustum, const StridedArrayReference<bool>& visible);
 };
 
+namespace Implementation {
+
+/* Frustum planes in SoA layout, padded to eight with planes that always
+   pass, so the fixed-size inner loops in the batch intersection functions
+   get unrolled and vectorized over the planes */
+template<class T> struct FrustumPlanes {
+    explicit FrustumPlanes(const Frustum<T>& frustum) {
+        for(std::size_t i = 0; i != 8; ++i) {
+            const Vector4<T> plane = i < 6 ? frustum[i] : Vector4<T>{T(0), T(0), T(0), T(1)};
+            x[i] = plane.x();
+            y[i] = plane.y();
+            z[i] = plane.z();
+            w[i] = plane.w();
+            absX[i] = std::abs(plane.x());
+            absY[i] = std::abs(plane.y());
+            absZ[i] = std::abs(plane.z());
+        }
+    }
+
+    T x[8], y[8], z[8], w[8], absX[8], absY[8], absZ[8];
+};
+
+}
+
+template<class T> void Intersection::sphereFrustum(const StridedArrayReference<const Vector3<T>>& centers, const StridedArrayReference<const T>& radii, const Frustum<T>& frustum, const StridedArrayReference<bool>& visible) {
+    CORRADE_ASSERT(centers.size() == radii.size() && centers.size() == visible.size(),
+        "Math::Geometry::Intersection::sphereFrustum(): expected arrays of the same size", );
+
+    const Implementation::FrustumPlanes<T> planes{frustum};
+    for(std::size_t i = 0; i != centers.size(); ++i) {
+        const Vector3<T> center = centers[i];
+        const T radius = radii[i];
+        bool inside = true;
+        for(std::size_t j = 0; j != 8; ++j)
+            inside &= planes.x[j]*center.x() + planes.y[j]*center.y() + planes.z[j]*center.z() + planes.w[j] >= -radius;
+        visible[i] = inside;
+    }
+}
+
+template<class T> void Intersection::rangeFrustum(const StridedArrayReference<const Range3D<T>>& ranges, const Frustum<T>& frustum, const StridedArrayReference<bool>& visible) {
+    CORRADE_ASSERT(ranges.size() == visible.size(),
+        "Math::Geometry::Intersection::rangeFrustum(): expected arrays of the same size", );
+
+    const Implementation::FrustumPlanes<T> planes{frustum};
+    for(std::size_t i = 0; i != ranges.size(); ++i) {
+        const Range3D<T>& range = ranges[i];
+        const Vector3<T> center = range.min() + range.max();
+        const Vector3<T> extent = range.max() - range.min();
+        bool inside = true;
+        for(std::size_t j = 0; j != 8; ++j) {
+            const T distance = planes.x[j]*center.x() + planes.y[j]*center.y() + planes.z[j]*center.z() + T(2)*planes.w[j];
+            const T radius = planes.absX[j]*extent.x() + planes.absY[j]*extent.y() + planes.absZ[j]*extent.z();
+            inside &= distance >= -radius;
+        }
+        visible[i] = inside;
+    }
+}
+
 }}}
 
 #endif
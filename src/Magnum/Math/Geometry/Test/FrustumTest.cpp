@@ -0,0 +1,137 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Geometry/Frustum.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+class FrustumTest: public Corrade::TestSuite::Tester {
+    public:
+        FrustumTest();
+
+        void construct();
+        void constructDefault();
+        void fromMatrixOrthographic();
+        void fromMatrixPerspective();
+        void compare();
+        void debug();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Geometry::Frustum<Float> Frustum;
+
+FrustumTest::FrustumTest() {
+    addTests({&FrustumTest::construct,
+              &FrustumTest::constructDefault,
+              &FrustumTest::fromMatrixOrthographic,
+              &FrustumTest::fromMatrixPerspective,
+              &FrustumTest::compare,
+              &FrustumTest::debug});
+}
+
+void FrustumTest::construct() {
+    Frustum a{
+        {2.0f, 0.0f, 0.0f, 4.0f},
+        {-1.0f, 0.0f, 0.0f, 1.0f},
+        {0.0f, 3.0f, 0.0f, 3.0f},
+        {0.0f, -1.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 1.0f, 1.0f},
+        {0.0f, 0.0f, -0.5f, 5.0f}};
+
+    /* The planes are normalized */
+    CORRADE_COMPARE(a[0], Vector4(1.0f, 0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a[1], Vector4(-1.0f, 0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(a[2], Vector4(0.0f, 1.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(a[3], Vector4(0.0f, -1.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a[4], Vector4(0.0f, 0.0f, 1.0f, 1.0f));
+    CORRADE_COMPARE(a[5], Vector4(0.0f, 0.0f, -1.0f, 10.0f));
+    CORRADE_COMPARE(a.data()[23], 10.0f);
+}
+
+void FrustumTest::constructDefault() {
+    constexpr Frustum a;
+    CORRADE_COMPARE(a, Frustum::fromMatrix({}));
+    CORRADE_COMPARE(a[3], Vector4(0.0f, -1.0f, 0.0f, 1.0f));
+}
+
+void FrustumTest::fromMatrixOrthographic() {
+    Frustum a = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 11.0f));
+
+    /* Planes in view space, camera looking to -Z */
+    CORRADE_COMPARE(a[0], Vector4(1.0f, 0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a[1], Vector4(-1.0f, 0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a[2], Vector4(0.0f, 1.0f, 0.0f, 3.0f));
+    CORRADE_COMPARE(a[3], Vector4(0.0f, -1.0f, 0.0f, 3.0f));
+    CORRADE_COMPARE(a[4], Vector4(0.0f, 0.0f, -1.0f, -1.0f));
+    CORRADE_COMPARE(a[5], Vector4(0.0f, 0.0f, 1.0f, 11.0f));
+}
+
+void FrustumTest::fromMatrixPerspective() {
+    const Matrix4 projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 10.0f);
+    Frustum a = Frustum::fromMatrix(projection);
+
+    /* 90° field of view, so the side planes are at 45° */
+    const Float s = Constants<Float>::sqrt2()*0.5f;
+    CORRADE_COMPARE(a[0], Vector4(s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(a[1], Vector4(-s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(a[2], Vector4(0.0f, s, -s, 0.0f));
+    CORRADE_COMPARE(a[3], Vector4(0.0f, -s, -s, 0.0f));
+    CORRADE_COMPARE(a[4], Vector4(0.0f, 0.0f, -1.0f, -1.0f));
+    CORRADE_COMPARE(a[5], Vector4(0.0f, 0.0f, 1.0f, 10.0f));
+
+    /* Camera moved 5 units forward, world-space planes move with it */
+    Frustum b = Frustum::fromMatrix(projection*Matrix4::translation({0.0f, 0.0f, 5.0f}));
+    CORRADE_COMPARE(b[4], Vector4(0.0f, 0.0f, -1.0f, -6.0f));
+}
+
+void FrustumTest::compare() {
+    Frustum a = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 11.0f));
+    Frustum b = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 11.0f + TypeTraits<Float>::epsilon()));
+    Frustum c = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 12.0f));
+
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(a != c);
+}
+
+void FrustumTest::debug() {
+    std::ostringstream out;
+    Debug(&out) << Frustum{};
+    CORRADE_COMPARE(out.str(), "Frustum({1, 0, 0, 1},\n"
+                               "        {-1, 0, 0, 1},\n"
+                               "        {0, 1, 0, 1},\n"
+                               "        {0, -1, 0, 1},\n"
+                               "        {0, 0, 1, 1},\n"
+                               "        {0, 0, -1, 1})\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::FrustumTest)
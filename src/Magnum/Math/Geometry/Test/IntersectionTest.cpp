@@ -24,6 +24,7 @@
 */
 
 #include <limits>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Geometry/Intersection.h"
@@ -36,14 +37,35 @@ class IntersectionTest: public Corrade::TestSuite::Tester {
 
         void planeLine();
         void lineLine();
+
+        void pointFrustum();
+        void sphereFrustum();
+        void rangeFrustum();
+        void boxFrustum();
+        void sphereFrustumBatch();
+        void rangeFrustumBatch();
+        void batchSizeMismatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Deg<Float> Deg;
+typedef Geometry::Frustum<Float> Frustum;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+
+              &IntersectionTest::pointFrustum,
+              &IntersectionTest::sphereFrustum,
+              &IntersectionTest::rangeFrustum,
+              &IntersectionTest::boxFrustum,
+              &IntersectionTest::sphereFrustumBatch,
+              &IntersectionTest::rangeFrustumBatch,
+              &IntersectionTest::batchSizeMismatch});
 }
 
 void IntersectionTest::planeLine() {
@@ -99,6 +121,109 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), std::numeric_limits<Float>::infinity());
 }
 
+namespace {
+
+/* Box from (-2, -2, -1) to (2, 2, -11), camera looking to -Z */
+const Frustum frustum = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 4.0f}, 1.0f, 11.0f));
+
+}
+
+void IntersectionTest::pointFrustum() {
+    CORRADE_VERIFY(Intersection::pointFrustum({0.0f, 0.0f, -5.0f}, frustum));
+    CORRADE_VERIFY(Intersection::pointFrustum({1.9f, -1.9f, -10.9f}, frustum));
+
+    /* Behind the camera, in front of near plane, beyond far plane, on the
+       sides */
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, 1.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, -0.5f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, -12.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({2.5f, 0.0f, -5.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, -2.5f, -5.0f}, frustum));
+}
+
+void IntersectionTest::sphereFrustum() {
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, -5.0f}, 1.0f, frustum));
+
+    /* Center outside, but the sphere reaches inside */
+    CORRADE_VERIFY(Intersection::sphereFrustum({3.0f, 0.0f, -5.0f}, 1.5f, frustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, 0.5f}, 2.0f, frustum));
+
+    /* Completely outside */
+    CORRADE_VERIFY(!Intersection::sphereFrustum({3.0f, 0.0f, -5.0f}, 0.5f, frustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, -13.0f}, 1.0f, frustum));
+}
+
+void IntersectionTest::rangeFrustum() {
+    CORRADE_VERIFY(Intersection::rangeFrustum(Range3D{{-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f}}, frustum));
+
+    /* Containing the whole frustum */
+    CORRADE_VERIFY(Intersection::rangeFrustum(Range3D{{-10.0f, -10.0f, -20.0f}, {10.0f, 10.0f, 10.0f}}, frustum));
+
+    /* Partially inside */
+    CORRADE_VERIFY(Intersection::rangeFrustum(Range3D{{1.5f, 1.5f, -3.0f}, {3.0f, 3.0f, 2.0f}}, frustum));
+
+    /* Outside */
+    CORRADE_VERIFY(!Intersection::rangeFrustum(Range3D{{2.5f, -1.0f, -6.0f}, {3.0f, 1.0f, -4.0f}}, frustum));
+    CORRADE_VERIFY(!Intersection::rangeFrustum(Range3D{{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 5.0f}}, frustum));
+}
+
+void IntersectionTest::boxFrustum() {
+    CORRADE_VERIFY(Intersection::boxFrustum(Matrix4::translation({0.0f, 0.0f, -5.0f}), frustum));
+
+    /* Axis-aligned box just outside, rotated by 45° it reaches inside */
+    const Matrix4 box = Matrix4::translation({3.2f, 0.0f, -5.0f})*Matrix4::scaling({1.0f, 1.0f, 0.1f});
+    CORRADE_VERIFY(!Intersection::boxFrustum(box, frustum));
+    CORRADE_VERIFY(Intersection::boxFrustum(box*Matrix4::rotationZ(Deg(45.0f)), frustum));
+
+    /* Far behind the camera */
+    CORRADE_VERIFY(!Intersection::boxFrustum(Matrix4::translation({0.0f, 0.0f, 5.0f})*Matrix4::rotationX(Deg(30.0f)), frustum));
+}
+
+void IntersectionTest::sphereFrustumBatch() {
+    const Vector3 centers[]{
+        {0.0f, 0.0f, -5.0f},
+        {3.0f, 0.0f, -5.0f},
+        {3.0f, 0.0f, -5.0f},
+        {0.0f, 0.0f, -13.0f},
+        {0.0f, 0.0f, 0.5f}
+    };
+    const Float radii[]{1.0f, 1.5f, 0.5f, 1.0f, 2.0f};
+    bool visible[5];
+    Intersection::sphereFrustum(StridedArrayReference<const Vector3>{centers}, StridedArrayReference<const Float>{radii}, frustum, StridedArrayReference<bool>{visible});
+
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(visible[i], Intersection::sphereFrustum(centers[i], radii[i], frustum));
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(!visible[3]);
+}
+
+void IntersectionTest::rangeFrustumBatch() {
+    const Range3D ranges[]{
+        {{-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f}},
+        {{-10.0f, -10.0f, -20.0f}, {10.0f, 10.0f, 10.0f}},
+        {{1.5f, 1.5f, -3.0f}, {3.0f, 3.0f, 2.0f}},
+        {{2.5f, -1.0f, -6.0f}, {3.0f, 1.0f, -4.0f}},
+        {{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 5.0f}}
+    };
+    bool visible[5];
+    Intersection::rangeFrustum(StridedArrayReference<const Range3D>{ranges}, frustum, StridedArrayReference<bool>{visible});
+
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(visible[i], Intersection::rangeFrustum(ranges[i], frustum));
+    CORRADE_VERIFY(visible[2]);
+    CORRADE_VERIFY(!visible[4]);
+}
+
+void IntersectionTest::batchSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const Range3D ranges[3];
+    bool visible[2];
+    Intersection::rangeFrustum(StridedArrayReference<const Range3D>{ranges}, frustum, StridedArrayReference<bool>{visible});
+    CORRADE_COMPARE(out.str(), "Math::Geometry::Intersection::rangeFrustum(): expected arrays of the same size\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
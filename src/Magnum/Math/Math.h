@@ -83,11 +83,12 @@ template<class T> using Range1D = Range<1, T>;
 template<class> class Range2D;
 template<class> class Range3D;
 
-#ifdef MAGNUM_BUILD_DEPRECATED
 namespace Geometry {
+    template<class> class Frustum;
+    #ifdef MAGNUM_BUILD_DEPRECATED
     template<class> class Rectangle;
+    #endif
 }
-#endif
 
 }}
 
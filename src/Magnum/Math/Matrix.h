@@ -29,12 +29,15 @@
  * @brief Class Magnum::Math::Matrix
  */
 
+#include <type_traits>
+
 #include "Magnum/Math/RectangularMatrix.h"
 
 namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t size, class T> class MatrixDeterminant;
+    template<std::size_t size, class T, class = void> class MatrixInverter;
 }
 
 /**
@@ -140,6 +143,8 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * determinant is computed directly: @f[
          *      \det(A) = a_{0, 0} a_{1, 1} - a_{1, 0} a_{0, 1}
          * @f]
+         * For 3x3 and 4x4 matrices the expansion is written out in closed
+         * form, with 2x2 subdeterminants of 4x4 matrix computed only once.
          */
         T determinant() const { return Implementation::MatrixDeterminant<size, T>()(*this); }
 
@@ -149,10 +154,13 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * Computed using Cramer's rule: @f[
          *      A^{-1} = \frac{1}{\det(A)} Adj(A)
          * @f]
+         * For 2x2, 3x3 and 4x4 matrices the adjugate is computed in closed
+         * form, sharing the subdeterminants with the determinant
+         * computation.
          * See invertedOrthogonal(), Matrix3::invertedRigid() and Matrix4::invertedRigid()
          * which are faster alternatives for particular matrix types.
          */
-        Matrix<size, T> inverted() const;
+        Matrix<size, T> inverted() const { return Implementation::MatrixInverter<size, T>()(*this); }
 
         /**
          * @brief Inverted orthogonal matrix
@@ -270,6 +278,38 @@ template<std::size_t size, class T> T MatrixDeterminant<size, T>::operator()(con
     return out;
 }
 
+template<class T> class MatrixDeterminant<4, T> {
+    public:
+        T operator()(const Matrix<4, T>& m) const;
+};
+
+template<class T> T MatrixDeterminant<4, T>::operator()(const Matrix<4, T>& m) const {
+    /* Laplace expansion by complementary 2x2 minors of first two and last
+       two columns */
+    const T s0 = m[0][0]*m[1][1] - m[0][1]*m[1][0];
+    const T s1 = m[0][0]*m[1][2] - m[0][2]*m[1][0];
+    const T s2 = m[0][0]*m[1][3] - m[0][3]*m[1][0];
+    const T s3 = m[0][1]*m[1][2] - m[0][2]*m[1][1];
+    const T s4 = m[0][1]*m[1][3] - m[0][3]*m[1][1];
+    const T s5 = m[0][2]*m[1][3] - m[0][3]*m[1][2];
+    const T c0 = m[2][0]*m[3][1] - m[2][1]*m[3][0];
+    const T c1 = m[2][0]*m[3][2] - m[2][2]*m[3][0];
+    const T c2 = m[2][0]*m[3][3] - m[2][3]*m[3][0];
+    const T c3 = m[2][1]*m[3][2] - m[2][2]*m[3][1];
+    const T c4 = m[2][1]*m[3][3] - m[2][3]*m[3][1];
+    const T c5 = m[2][2]*m[3][3] - m[2][3]*m[3][2];
+    return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+}
+
+template<class T> class MatrixDeterminant<3, T> {
+    public:
+        constexpr T operator()(const Matrix<3, T>& m) const {
+            return m[0][0]*(m[1][1]*m[2][2] - m[2][1]*m[1][2]) -
+                   m[1][0]*(m[0][1]*m[2][2] - m[2][1]*m[0][2]) +
+                   m[2][0]*(m[0][1]*m[1][2] - m[1][1]*m[0][2]);
+        }
+};
+
 template<class T> class MatrixDeterminant<2, T> {
     public:
         constexpr T operator()(const Matrix<2, T>& m) const {
@@ -284,6 +324,102 @@ template<class T> class MatrixDeterminant<1, T> {
         }
 };
 
+template<std::size_t size, class T, class> class MatrixInverter {
+    public:
+        Matrix<size, T> operator()(const Matrix<size, T>& m) const;
+};
+
+template<std::size_t size, class T, class U> Matrix<size, T> MatrixInverter<size, T, U>::operator()(const Matrix<size, T>& m) const {
+    Matrix<size, T> out(Matrix<size, T>::Zero);
+
+    const T _determinant = m.determinant();
+
+    for(std::size_t col = 0; col != size; ++col)
+        for(std::size_t row = 0; row != size; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/_determinant;
+
+    return out;
+}
+
+/* Closed-form inverses multiply by reciprocal of the determinant, which
+   would truncate to zero for integral types, so these are enabled only for
+   floating-point types and the integral ones use the generic version */
+template<class T> class MatrixInverter<4, T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    public:
+        Matrix<4, T> operator()(const Matrix<4, T>& m) const;
+};
+
+template<class T> Matrix<4, T> MatrixInverter<4, T, typename std::enable_if<std::is_floating_point<T>::value>::type>::operator()(const Matrix<4, T>& m) const {
+    /* Same 2x2 minors as in MatrixDeterminant<4, T>, each adjugate element
+       is then combination of three of them */
+    const T s0 = m[0][0]*m[1][1] - m[0][1]*m[1][0];
+    const T s1 = m[0][0]*m[1][2] - m[0][2]*m[1][0];
+    const T s2 = m[0][0]*m[1][3] - m[0][3]*m[1][0];
+    const T s3 = m[0][1]*m[1][2] - m[0][2]*m[1][1];
+    const T s4 = m[0][1]*m[1][3] - m[0][3]*m[1][1];
+    const T s5 = m[0][2]*m[1][3] - m[0][3]*m[1][2];
+    const T c0 = m[2][0]*m[3][1] - m[2][1]*m[3][0];
+    const T c1 = m[2][0]*m[3][2] - m[2][2]*m[3][0];
+    const T c2 = m[2][0]*m[3][3] - m[2][3]*m[3][0];
+    const T c3 = m[2][1]*m[3][2] - m[2][2]*m[3][1];
+    const T c4 = m[2][1]*m[3][3] - m[2][3]*m[3][1];
+    const T c5 = m[2][2]*m[3][3] - m[2][3]*m[3][2];
+
+    const T invDeterminant = T(1)/(s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+
+    return {
+        Vector<4, T>(( m[1][1]*c5 - m[1][2]*c4 + m[1][3]*c3)*invDeterminant,
+                     (-m[0][1]*c5 + m[0][2]*c4 - m[0][3]*c3)*invDeterminant,
+                     ( m[3][1]*s5 - m[3][2]*s4 + m[3][3]*s3)*invDeterminant,
+                     (-m[2][1]*s5 + m[2][2]*s4 - m[2][3]*s3)*invDeterminant),
+        Vector<4, T>((-m[1][0]*c5 + m[1][2]*c2 - m[1][3]*c1)*invDeterminant,
+                     ( m[0][0]*c5 - m[0][2]*c2 + m[0][3]*c1)*invDeterminant,
+                     (-m[3][0]*s5 + m[3][2]*s2 - m[3][3]*s1)*invDeterminant,
+                     ( m[2][0]*s5 - m[2][2]*s2 + m[2][3]*s1)*invDeterminant),
+        Vector<4, T>(( m[1][0]*c4 - m[1][1]*c2 + m[1][3]*c0)*invDeterminant,
+                     (-m[0][0]*c4 + m[0][1]*c2 - m[0][3]*c0)*invDeterminant,
+                     ( m[3][0]*s4 - m[3][1]*s2 + m[3][3]*s0)*invDeterminant,
+                     (-m[2][0]*s4 + m[2][1]*s2 - m[2][3]*s0)*invDeterminant),
+        Vector<4, T>((-m[1][0]*c3 + m[1][1]*c1 - m[1][2]*c0)*invDeterminant,
+                     ( m[0][0]*c3 - m[0][1]*c1 + m[0][2]*c0)*invDeterminant,
+                     (-m[3][0]*s3 + m[3][1]*s1 - m[3][2]*s0)*invDeterminant,
+                     ( m[2][0]*s3 - m[2][1]*s1 + m[2][2]*s0)*invDeterminant)
+    };
+}
+
+template<class T> class MatrixInverter<3, T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    public:
+        Matrix<3, T> operator()(const Matrix<3, T>& m) const;
+};
+
+template<class T> Matrix<3, T> MatrixInverter<3, T, typename std::enable_if<std::is_floating_point<T>::value>::type>::operator()(const Matrix<3, T>& m) const {
+    /* Rows of the adjugate are cross products of the columns */
+    const T a0 = m[1][1]*m[2][2] - m[2][1]*m[1][2];
+    const T a1 = m[2][1]*m[0][2] - m[0][1]*m[2][2];
+    const T a2 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+
+    const T invDeterminant = T(1)/(m[0][0]*a0 + m[1][0]*a1 + m[2][0]*a2);
+
+    return {
+        Vector<3, T>(a0*invDeterminant, a1*invDeterminant, a2*invDeterminant),
+        Vector<3, T>((m[2][0]*m[1][2] - m[1][0]*m[2][2])*invDeterminant,
+                     (m[0][0]*m[2][2] - m[2][0]*m[0][2])*invDeterminant,
+                     (m[1][0]*m[0][2] - m[0][0]*m[1][2])*invDeterminant),
+        Vector<3, T>((m[1][0]*m[2][1] - m[2][0]*m[1][1])*invDeterminant,
+                     (m[2][0]*m[0][1] - m[0][0]*m[2][1])*invDeterminant,
+                     (m[0][0]*m[1][1] - m[1][0]*m[0][1])*invDeterminant)
+    };
+}
+
+template<class T> class MatrixInverter<2, T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    public:
+        Matrix<2, T> operator()(const Matrix<2, T>& m) const {
+            const T invDeterminant = T(1)/m.determinant();
+            return {Vector<2, T>( m[1][1]*invDeterminant, -m[0][1]*invDeterminant),
+                    Vector<2, T>(-m[1][0]*invDeterminant,  m[0][0]*invDeterminant)};
+        }
+};
+
 }
 #endif
 
@@ -312,18 +448,6 @@ template<std::size_t size, class T> Matrix<size-1, T> Matrix<size, T>::ij(const
     return out;
 }
 
-template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted() const {
-    Matrix<size, T> out(Zero);
-
-    const T _determinant = determinant();
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != size; ++row)
-            out[col][row] = (((row+col) & 1) ? -1 : 1)*ij(row, col).determinant()/_determinant;
-
-    return out;
-}
-
 }}
 
 namespace Corrade { namespace Utility {
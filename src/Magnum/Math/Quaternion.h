@@ -552,6 +552,27 @@ template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion
             _scalar*other._scalar - Vector3<T>::dot(_vector, other._vector)};
 }
 
+#if defined(MAGNUM_MATH_SIMD_SSE2) || defined(MAGNUM_MATH_SIMD_NEON)
+/* SIMD specialization for float quaternions. The vector part is computed
+   with the same operation order as in the scalar code, so the results are the
+   same to the last bit. The fourth lane is unused. */
+template<> inline Quaternion<Float> Quaternion<Float>::operator*(const Quaternion<Float>& other) const {
+    const Vector3<Float>& a = _vector;
+    const Vector3<Float>& b = other._vector;
+    const Implementation::Float4 vector = Implementation::float4Add(
+        Implementation::float4Add(
+            Implementation::float4Mul(Implementation::float4Set(b[0], b[1], b[2], 0.0f), Implementation::float4Splat(_scalar)),
+            Implementation::float4Mul(Implementation::float4Set(a[0], a[1], a[2], 0.0f), Implementation::float4Splat(other._scalar))),
+        Implementation::float4Sub(
+            Implementation::float4Mul(Implementation::float4Set(a[1], a[2], a[0], 0.0f), Implementation::float4Set(b[2], b[0], b[1], 0.0f)),
+            Implementation::float4Mul(Implementation::float4Set(a[2], a[0], a[1], 0.0f), Implementation::float4Set(b[1], b[2], b[0], 0.0f))));
+
+    Float out[4];
+    Implementation::float4Store(out, vector);
+    return {{out[0], out[1], out[2]}, _scalar*other._scalar - Vector3<Float>::dot(a, b)};
+}
+#endif
+
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized",
         Quaternion<T>({}, std::numeric_limits<T>::quiet_NaN()));
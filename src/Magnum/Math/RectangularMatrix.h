@@ -665,6 +665,39 @@ template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...se
 }
 #endif
 
+#if defined(MAGNUM_MATH_SIMD_SSE2) || defined(MAGNUM_MATH_SIMD_NEON)
+/* SIMD specializations for 4x4 float matrix multiplication with matrix and
+   vector. Each output column is accumulated in the same order as in the
+   scalar code, so the results are the same to the last bit. */
+template<> template<> inline RectangularMatrix<4, 4, Float> RectangularMatrix<4, 4, Float>::operator*(const RectangularMatrix<4, 4, Float>& other) const {
+    const Implementation::Float4 a[]{
+        Implementation::float4Load(_data[0].data()),
+        Implementation::float4Load(_data[1].data()),
+        Implementation::float4Load(_data[2].data()),
+        Implementation::float4Load(_data[3].data())};
+
+    RectangularMatrix<4, 4, Float> out;
+    for(std::size_t col = 0; col != 4; ++col) {
+        Implementation::Float4 sum = Implementation::float4Zero();
+        for(std::size_t pos = 0; pos != 4; ++pos)
+            sum = Implementation::float4Add(sum, Implementation::float4Mul(a[pos], Implementation::float4Splat(other._data[col][pos])));
+        Implementation::float4Store(out._data[col].data(), sum);
+    }
+
+    return out;
+}
+
+template<> template<> inline RectangularMatrix<1, 4, Float> RectangularMatrix<4, 4, Float>::operator*(const RectangularMatrix<1, 4, Float>& other) const {
+    Implementation::Float4 sum = Implementation::float4Zero();
+    for(std::size_t pos = 0; pos != 4; ++pos)
+        sum = Implementation::float4Add(sum, Implementation::float4Mul(Implementation::float4Load(_data[pos].data()), Implementation::float4Splat(other._data[0][pos])));
+
+    RectangularMatrix<1, 4, Float> out;
+    Implementation::float4Store(out._data[0].data(), sum);
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -0,0 +1,297 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class BatchTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit BatchTest();
+
+        void reference();
+        void referenceConst();
+
+        void transformPoints();
+        void transformPointsStrided();
+        void transformPointsInPlace();
+        void transformVectors();
+        void normalize();
+        void dot();
+        void lerp();
+        void slerp();
+        void multiply();
+        void multiplyAccumulate();
+        void minmax();
+        void minmaxStrided();
+
+        void sizeMismatch();
+        void empty();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::reference,
+              &BatchTest::referenceConst,
+
+              &BatchTest::transformPoints,
+              &BatchTest::transformPointsStrided,
+              &BatchTest::transformPointsInPlace,
+              &BatchTest::transformVectors,
+              &BatchTest::normalize,
+              &BatchTest::dot,
+              &BatchTest::lerp,
+              &BatchTest::slerp,
+              &BatchTest::multiply,
+              &BatchTest::multiplyAccumulate,
+              &BatchTest::minmax,
+              &BatchTest::minmaxStrided,
+
+              &BatchTest::sizeMismatch,
+              &BatchTest::empty});
+}
+
+namespace {
+
+struct Vertex {
+    Vector3 position;
+    Float weight;
+};
+
+}
+
+void BatchTest::reference() {
+    Vertex vertices[]{
+        {{1.0f, 2.0f, 3.0f}, 0.5f},
+        {{4.0f, 5.0f, 6.0f}, 0.25f}
+    };
+
+    StridedArrayReference<Vector3> a{&vertices[0].position, 2, sizeof(Vertex)};
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.stride(), sizeof(Vertex));
+    CORRADE_VERIFY(!a.isContiguous());
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_COMPARE(a[1], Vector3(4.0f, 5.0f, 6.0f));
+
+    a[1].y() = 7.0f;
+    CORRADE_COMPARE(vertices[1].position, Vector3(4.0f, 7.0f, 6.0f));
+
+    Float weights[]{0.5f, 0.25f, 0.125f};
+    StridedArrayReference<Float> b = weights;
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_VERIFY(b.isContiguous());
+    CORRADE_COMPARE(b[2], 0.125f);
+
+    StridedArrayReference<Float> c;
+    CORRADE_VERIFY(c.empty());
+    CORRADE_VERIFY(!c.data());
+}
+
+void BatchTest::referenceConst() {
+    Vector3 data[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    StridedArrayReference<Vector3> a = data;
+    StridedArrayReference<const Vector3> b = a;
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[1], Vector3(4.0f, 5.0f, 6.0f));
+
+    /* Conversion from const to non-const is not allowed */
+    CORRADE_VERIFY((std::is_convertible<StridedArrayReference<Vector3>, StridedArrayReference<const Vector3>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<StridedArrayReference<const Vector3>, StridedArrayReference<Vector3>>::value));
+}
+
+void BatchTest::transformPoints() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.0f})*Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling(Vector3(2.0f));
+    const Vector3 in[]{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 1.0f}, {-3.0f, 2.0f, 0.5f}};
+    Vector3 out[3];
+
+    Math::transformPoints(matrix, StridedArrayReference<const Vector3>{in}, StridedArrayReference<Vector3>{out});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], matrix.transformPoint(in[i]));
+}
+
+void BatchTest::transformPointsStrided() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.0f})*Matrix4::rotationX(Deg(30.0f));
+    Vertex in[]{
+        {{1.0f, 0.0f, 0.0f}, 0.5f},
+        {{0.0f, 1.0f, 1.0f}, 0.25f},
+        {{-3.0f, 2.0f, 0.5f}, 0.125f}
+    };
+    Vector3 out[3];
+
+    Math::transformPoints(matrix, StridedArrayReference<const Vector3>{&in[0].position, 3, sizeof(Vertex)}, StridedArrayReference<Vector3>{out});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], matrix.transformPoint(in[i].position));
+
+    /* Other attributes are not touched */
+    Math::transformPoints(matrix, StridedArrayReference<Vector3>{out}, StridedArrayReference<Vector3>{&in[0].position, 3, sizeof(Vertex)});
+    CORRADE_COMPARE(in[0].weight, 0.5f);
+    CORRADE_COMPARE(in[1].weight, 0.25f);
+    CORRADE_COMPARE(in[2].weight, 0.125f);
+}
+
+void BatchTest::transformPointsInPlace() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.0f})*Matrix4::rotationY(Deg(45.0f));
+    const Vector3 original[]{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 1.0f}};
+    Vector3 data[]{original[0], original[1]};
+
+    StridedArrayReference<Vector3> view = data;
+    Math::transformPoints(matrix, view, view);
+    CORRADE_COMPARE(data[0], matrix.transformPoint(original[0]));
+    CORRADE_COMPARE(data[1], matrix.transformPoint(original[1]));
+}
+
+void BatchTest::transformVectors() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.0f})*Matrix4::rotationZ(Deg(90.0f));
+    const Vector3 in[]{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 1.0f}};
+    Vector3 out[2];
+
+    Math::transformVectors(matrix, StridedArrayReference<const Vector3>{in}, StridedArrayReference<Vector3>{out});
+    CORRADE_COMPARE(out[0], Vector3(0.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(out[1], Vector3(-1.0f, 0.0f, 1.0f));
+}
+
+void BatchTest::normalize() {
+    Vector3 data[]{{3.0f, 0.0f, 4.0f}, {0.0f, -2.0f, 0.0f}};
+    StridedArrayReference<Vector3> view = data;
+    Math::normalize(view, view);
+    CORRADE_COMPARE(data[0], Vector3(0.6f, 0.0f, 0.8f));
+    CORRADE_COMPARE(data[1], Vector3(0.0f, -1.0f, 0.0f));
+}
+
+void BatchTest::dot() {
+    const Vector3 a[]{{1.0f, 2.0f, 3.0f}, {-1.0f, 0.5f, 2.0f}};
+    const Vector3 b[]{{4.0f, 5.0f, 6.0f}, {2.0f, 4.0f, 0.25f}};
+    Float out[2];
+    Math::dot(StridedArrayReference<const Vector3>{a}, StridedArrayReference<const Vector3>{b}, StridedArrayReference<Float>{out});
+    CORRADE_COMPARE(out[0], 32.0f);
+    CORRADE_COMPARE(out[1], 0.5f);
+}
+
+void BatchTest::lerp() {
+    const Vector3 a[]{{1.0f, 2.0f, 3.0f}, {-1.0f, 0.5f, 2.0f}};
+    const Vector3 b[]{{3.0f, 6.0f, 5.0f}, {1.0f, 0.5f, 0.0f}};
+    Vector3 out[2];
+    Math::lerp(StridedArrayReference<const Vector3>{a}, StridedArrayReference<const Vector3>{b}, 0.25f, StridedArrayReference<Vector3>{out});
+    CORRADE_COMPARE(out[0], Vector3(1.5f, 3.0f, 3.5f));
+    CORRADE_COMPARE(out[1], Vector3(-0.5f, 0.5f, 1.5f));
+}
+
+void BatchTest::slerp() {
+    const Quaternion a[]{
+        Quaternion::rotation(Deg(15.0f), Vector3::xAxis()),
+        Quaternion::rotation(Deg(30.0f), Vector3::yAxis())
+    };
+    const Quaternion b[]{
+        Quaternion::rotation(Deg(45.0f), Vector3::xAxis()),
+        Quaternion::rotation(Deg(90.0f), Vector3::zAxis())
+    };
+    Quaternion out[2];
+    Math::slerp(StridedArrayReference<const Quaternion>{a}, StridedArrayReference<const Quaternion>{b}, 0.35f, StridedArrayReference<Quaternion>{out});
+    CORRADE_COMPARE(out[0], Quaternion::rotation(Deg(25.5f), Vector3::xAxis()));
+    CORRADE_COMPARE(out[1], Quaternion::slerp(a[1], b[1], 0.35f));
+}
+
+void BatchTest::multiply() {
+    const Matrix4 a[]{Matrix4::translation(Vector3::xAxis()), Matrix4::scaling(Vector3(2.0f))};
+    const Matrix4 b[]{Matrix4::rotationZ(Deg(90.0f)), Matrix4::translation(Vector3::yAxis())};
+    Matrix4 out[2];
+    Math::multiply(StridedArrayReference<const Matrix4>{a}, StridedArrayReference<const Matrix4>{b}, StridedArrayReference<Matrix4>{out});
+    CORRADE_COMPARE(out[0], a[0]*b[0]);
+    CORRADE_COMPARE(out[1], a[1]*b[1]);
+}
+
+void BatchTest::multiplyAccumulate() {
+    const Matrix4 values[]{Matrix4::translation(Vector3::xAxis()), Matrix4::translation(Vector3::yAxis()*3.0f)};
+    const Float weights[]{0.75f, 0.25f};
+    CORRADE_COMPARE(Math::multiplyAccumulate(StridedArrayReference<const Matrix4>{values}, StridedArrayReference<const Float>{weights}),
+        Matrix4::translation({0.75f, 0.75f, 0.0f}));
+
+    const Vector3 vectors[]{{1.0f, 2.0f, 3.0f}, {-2.0f, 4.0f, 1.0f}};
+    CORRADE_COMPARE(Math::multiplyAccumulate(StridedArrayReference<const Vector3>{vectors}, StridedArrayReference<const Float>{weights}),
+        Vector3(0.25f, 2.5f, 2.5f));
+}
+
+void BatchTest::minmax() {
+    const Float scalars[]{3.0f, -1.0f, 5.0f, 2.0f};
+    StridedArrayReference<const Float> a = scalars;
+    CORRADE_COMPARE(Math::min(a), -1.0f);
+    CORRADE_COMPARE(Math::max(a), 5.0f);
+    CORRADE_COMPARE(Math::minmax(a), std::make_pair(-1.0f, 5.0f));
+
+    const Vector3 vectors[]{{1.0f, 2.0f, 3.0f}, {-2.0f, 4.0f, 1.0f}, {0.0f, -1.0f, 2.0f}};
+    StridedArrayReference<const Vector3> b = vectors;
+    CORRADE_COMPARE(Math::min(b), Vector3(-2.0f, -1.0f, 1.0f));
+    CORRADE_COMPARE(Math::max(b), Vector3(1.0f, 4.0f, 3.0f));
+    CORRADE_COMPARE(Math::minmax(b), std::make_pair(Vector3(-2.0f, -1.0f, 1.0f), Vector3(1.0f, 4.0f, 3.0f)));
+}
+
+void BatchTest::minmaxStrided() {
+    const Vertex vertices[]{
+        {{1.0f, 2.0f, 3.0f}, 0.5f},
+        {{-2.0f, 4.0f, 1.0f}, -0.25f},
+        {{0.0f, -1.0f, 2.0f}, 0.125f}
+    };
+
+    CORRADE_COMPARE(Math::minmax(StridedArrayReference<const Float>{&vertices[0].weight, 3, sizeof(Vertex)}), std::make_pair(-0.25f, 0.5f));
+    CORRADE_COMPARE(Math::minmax(StridedArrayReference<const Vector3>{&vertices[0].position, 3, sizeof(Vertex)}),
+        std::make_pair(Vector3(-2.0f, -1.0f, 1.0f), Vector3(1.0f, 4.0f, 3.0f)));
+}
+
+void BatchTest::sizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Vector3 a[3];
+    Vector3 b[2];
+    Float c[3];
+    Math::transformPoints(Matrix4{}, StridedArrayReference<Vector3>{a}, StridedArrayReference<Vector3>{b});
+    Math::dot(StridedArrayReference<Vector3>{a}, StridedArrayReference<Vector3>{b}, StridedArrayReference<Float>{c});
+    CORRADE_COMPARE(out.str(), "Math::transformPoints(): expected arrays of the same size, got 3 and 2\n"
+                               "Math::dot(): expected input arrays of the same size, got 3 and 2\n");
+}
+
+void BatchTest::empty() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Math::min(StridedArrayReference<const Float>{});
+    Math::minmax(StridedArrayReference<const Vector3>{});
+    Math::multiplyAccumulate(StridedArrayReference<const Vector3>{}, StridedArrayReference<const Float>{});
+    CORRADE_COMPARE(out.str(), "Math::min(): the array is empty\n"
+                               "Math::minmax(): the array is empty\n"
+                               "Math::multiplyAccumulate(): expected non-empty arrays of the same size, got 0 and 0\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchTest)
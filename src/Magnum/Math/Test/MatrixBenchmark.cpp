@@ -0,0 +1,139 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MatrixBenchmark.h"
+
+#include <QtTest/QTest>
+
+#include "Magnum/Math/Matrix.h"
+
+QTEST_APPLESS_MAIN(Magnum::Math::Test::MatrixBenchmark)
+
+namespace Magnum { namespace Math { namespace Test {
+
+namespace {
+
+typedef Math::Matrix<3, Float> Matrix3x3;
+typedef Math::Matrix<4, Float> Matrix4x4;
+typedef Math::Vector<3, Float> Vector3;
+typedef Math::Vector<4, Float> Vector4;
+
+const Matrix3x3 m3(Vector3(1.0f, 2.0f, 3.0f),
+                   Vector3(0.0f, 4.0f, 5.0f),
+                   Vector3(1.0f, 0.0f, 6.0f));
+
+const Matrix4x4 m4(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
+                   Vector4(4.0f,  4.0f, 7.0f, 3.0f),
+                   Vector4(7.0f, -1.0f, 8.0f, 0.0f),
+                   Vector4(9.0f,  4.0f, 5.0f, 9.0f));
+
+/* The generic Laplace expansion, as used for matrices larger than 4x4 */
+template<std::size_t size> Float determinantGeneric(const Matrix<size, Float>& m) {
+    Float out(0);
+    for(std::size_t col = 0; col != size; ++col)
+        out += ((col & 1) ? -1 : 1)*m[col][0]*determinantGeneric<size-1>(m.ij(col, 0));
+    return out;
+}
+
+template<> Float determinantGeneric<2>(const Matrix<2, Float>& m) {
+    return m[0][0]*m[1][1] - m[1][0]*m[0][1];
+}
+
+template<std::size_t size> Matrix<size, Float> invertedGeneric(const Matrix<size, Float>& m) {
+    Matrix<size, Float> out(Matrix<size, Float>::Zero);
+    const Float determinant = determinantGeneric<size>(m);
+    for(std::size_t col = 0; col != size; ++col)
+        for(std::size_t row = 0; row != size; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*determinantGeneric<size-1>(m.ij(row, col))/determinant;
+    return out;
+}
+
+}
+
+void MatrixBenchmark::determinant3Generic() {
+    Float out{};
+    QBENCHMARK {
+        out += determinantGeneric<3>(m3);
+    }
+    QVERIFY(out != 0.0f);
+}
+
+void MatrixBenchmark::determinant3() {
+    Float out{};
+    QBENCHMARK {
+        out += m3.determinant();
+    }
+    QVERIFY(out != 0.0f);
+}
+
+void MatrixBenchmark::determinant4Generic() {
+    Float out{};
+    QBENCHMARK {
+        out += determinantGeneric<4>(m4);
+    }
+    QVERIFY(out != 0.0f);
+}
+
+void MatrixBenchmark::determinant4() {
+    Float out{};
+    QBENCHMARK {
+        out += m4.determinant();
+    }
+    QVERIFY(out != 0.0f);
+}
+
+void MatrixBenchmark::inverted3Generic() {
+    Matrix3x3 out;
+    QBENCHMARK {
+        out = invertedGeneric<3>(out*m3);
+    }
+    QVERIFY(out != Matrix3x3(Matrix3x3::Zero));
+}
+
+void MatrixBenchmark::inverted3() {
+    Matrix3x3 out;
+    QBENCHMARK {
+        out = (out*m3).inverted();
+    }
+    QVERIFY(out != Matrix3x3(Matrix3x3::Zero));
+}
+
+void MatrixBenchmark::inverted4Generic() {
+    Matrix4x4 out;
+    QBENCHMARK {
+        out = invertedGeneric<4>(out*m4);
+    }
+    QVERIFY(out != Matrix4x4(Matrix4x4::Zero));
+}
+
+void MatrixBenchmark::inverted4() {
+    Matrix4x4 out;
+    QBENCHMARK {
+        out = (out*m4).inverted();
+    }
+    QVERIFY(out != Matrix4x4(Matrix4x4::Zero));
+}
+
+}}}
@@ -73,7 +73,14 @@ class MatrixTest: public Corrade::TestSuite::Tester {
         void trace();
         void ij();
         void determinant();
+        void determinant2();
+        void determinant3();
+        void determinant4();
         void inverted();
+        void inverted2();
+        void inverted3();
+        void inverted5();
+        void invertedInteger();
         void invertedOrthogonal();
 
         void subclassTypes();
@@ -86,9 +93,11 @@ class MatrixTest: public Corrade::TestSuite::Tester {
 typedef Matrix<4, Float> Matrix4x4;
 typedef Matrix<4, Int> Matrix4x4i;
 typedef Matrix<3, Float> Matrix3x3;
+typedef Matrix<2, Float> Matrix2x2;
 typedef Vector<4, Float> Vector4;
 typedef Vector<4, Int> Vector4i;
 typedef Vector<3, Float> Vector3;
+typedef Vector<2, Float> Vector2;
 typedef Math::Constants<Float> Constants;
 
 MatrixTest::MatrixTest() {
@@ -105,7 +114,14 @@ MatrixTest::MatrixTest() {
               &MatrixTest::trace,
               &MatrixTest::ij,
               &MatrixTest::determinant,
+              &MatrixTest::determinant2,
+              &MatrixTest::determinant3,
+              &MatrixTest::determinant4,
               &MatrixTest::inverted,
+              &MatrixTest::inverted2,
+              &MatrixTest::inverted3,
+              &MatrixTest::inverted5,
+              &MatrixTest::invertedInteger,
               &MatrixTest::invertedOrthogonal,
 
               &MatrixTest::subclassTypes,
@@ -256,6 +272,32 @@ void MatrixTest::determinant() {
     CORRADE_COMPARE(m.determinant(), -2);
 }
 
+void MatrixTest::determinant2() {
+    Matrix<2, Int> m(Vector<2, Int>(2, 3),
+                     Vector<2, Int>(1, 4));
+
+    CORRADE_COMPARE(m.determinant(), 5);
+}
+
+void MatrixTest::determinant3() {
+    Matrix<3, Int> m(Vector<3, Int>(1, 2, 3),
+                     Vector<3, Int>(0, 4, 5),
+                     Vector<3, Int>(1, 0, 6));
+
+    CORRADE_COMPARE(m.determinant(), 22);
+    CORRADE_COMPARE((Matrix<3, Int>{m.transposed()}.determinant()), 22);
+}
+
+void MatrixTest::determinant4() {
+    Matrix<4, Int> m(Vector<4, Int>(3,  5, 8, 4),
+                     Vector<4, Int>(4,  4, 7, 3),
+                     Vector<4, Int>(7, -1, 8, 0),
+                     Vector<4, Int>(9,  4, 5, 9));
+
+    CORRADE_COMPARE(m.determinant(), -412);
+    CORRADE_COMPARE(Matrix4x4i{m.transposed()}.determinant(), -412);
+}
+
 void MatrixTest::inverted() {
     Matrix4x4 m(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
                 Vector4(4.0f,  4.0f, 7.0f, 3.0f),
@@ -273,6 +315,83 @@ void MatrixTest::inverted() {
     CORRADE_COMPARE(_inverse*m, Matrix4x4());
 }
 
+void MatrixTest::inverted2() {
+    Matrix2x2 m(Vector2(2.0f, 3.0f),
+                Vector2(1.0f, 4.0f));
+
+    Matrix2x2 inverse(Vector2( 4/5.0f, -3/5.0f),
+                      Vector2(-1/5.0f,  2/5.0f));
+
+    CORRADE_COMPARE(m.inverted(), inverse);
+    CORRADE_COMPARE(m.inverted()*m, Matrix2x2());
+}
+
+void MatrixTest::inverted3() {
+    Matrix3x3 m(Vector3(1.0f, 2.0f, 3.0f),
+                Vector3(0.0f, 4.0f, 5.0f),
+                Vector3(1.0f, 0.0f, 6.0f));
+
+    Matrix3x3 inverse(Vector3(12/11.0f, -6/11.0f, -1/11.0f),
+                      Vector3( 5/22.0f,  3/22.0f, -5/22.0f),
+                      Vector3(-2/11.0f,  1/11.0f,  2/11.0f));
+
+    CORRADE_COMPARE(m.inverted(), inverse);
+    CORRADE_COMPARE(m.inverted()*m, Matrix3x3());
+}
+
+void MatrixTest::inverted5() {
+    /* Generic implementation */
+    Matrix<5, Float> m(
+        Vector<5, Float>(1.0f, 2.0f, 2.0f, 1.0f,  0.0f),
+        Vector<5, Float>(2.0f, 3.0f, 2.0f, 1.0f, -2.0f),
+        Vector<5, Float>(1.0f, 1.0f, 1.0f, 1.0f,  0.0f),
+        Vector<5, Float>(2.0f, 0.0f, 0.0f, 1.0f,  2.0f),
+        Vector<5, Float>(3.0f, 1.0f, 0.0f, 1.0f, -2.0f)
+    );
+
+    Matrix<5, Float> inverse(
+        Vector<5, Float>( 2.0f, -1.0f, -2.0f,  0.0f,  1.0f),
+        Vector<5, Float>(-4.0f,  3.0f,  2.0f,  1.0f, -2.0f),
+        Vector<5, Float>( 5.0f, -3.0f, -3.0f, -1.0f,  2.0f),
+        Vector<5, Float>(-3.0f,  1.0f,  4.0f,  0.0f, -1.0f),
+        Vector<5, Float>(-0.5f,  0.5f,  0.0f,  0.5f, -0.5f)
+    );
+
+    CORRADE_COMPARE(m.inverted(), inverse);
+}
+
+void MatrixTest::invertedInteger() {
+    /* Unimodular matrices have exact integral inverse */
+    Matrix<2, Int> m2(Vector<2, Int>(2, 1),
+                      Vector<2, Int>(1, 1));
+    CORRADE_COMPARE(m2.inverted(), (Matrix<2, Int>(Vector<2, Int>( 1, -1),
+                                                   Vector<2, Int>(-1,  2))));
+
+    Matrix<3, Int> m3(Vector<3, Int>(1, 2, 3),
+                      Vector<3, Int>(0, 1, 4),
+                      Vector<3, Int>(5, 6, 0));
+    CORRADE_COMPARE(m3.inverted(), (Matrix<3, Int>(Vector<3, Int>(-24, 18,  5),
+                                                   Vector<3, Int>( 20, -15, -4),
+                                                   Vector<3, Int>( -5,  4,  1))));
+
+    Matrix4x4i m4(Vector4i(1, 0, 0, 0),
+                  Vector4i(0, 1, 0, 0),
+                  Vector4i(0, 0, 1, 0),
+                  Vector4i(3, 2, 1, 1));
+    CORRADE_COMPARE(m4.inverted(), Matrix4x4i(Vector4i( 1,  0,  0, 0),
+                                              Vector4i( 0,  1,  0, 0),
+                                              Vector4i( 0,  0,  1, 0),
+                                              Vector4i(-3, -2, -1, 1)));
+
+    /* Non-integral inverse is truncated elementwise, not zeroed out */
+    Matrix<3, Int> d(Vector<3, Int>(2, 0, 0),
+                     Vector<3, Int>(0, 2, 0),
+                     Vector<3, Int>(0, 0, 1));
+    CORRADE_COMPARE(d.inverted(), (Matrix<3, Int>(Vector<3, Int>(0, 0, 0),
+                                                  Vector<3, Int>(0, 0, 0),
+                                                  Vector<3, Int>(0, 0, 1))));
+}
+
 void MatrixTest::invertedOrthogonal() {
     std::ostringstream o;
     Error::setOutput(&o);
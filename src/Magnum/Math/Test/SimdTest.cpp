@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Verifies that the SIMD specializations (if enabled with MAGNUM_MATH_SIMD)
+   are bit-exact with the scalar implementation, which is written out
+   explicitly here */
+class SimdTest: public Corrade::TestSuite::Tester {
+    public:
+        SimdTest();
+
+        void vectorArithmetic();
+        void vectorNegateZero();
+        void vectorDot();
+        void matrixMultiply();
+        void matrixTransform();
+        void quaternionMultiply();
+};
+
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+
+namespace {
+
+template<class T> bool bitEqual(const T& a, const T& b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/* Values which don't have exact binary representation, so any difference in
+   rounding would show up */
+const Vector4 a(0.1f, -1.3f, 7.7f, 1.0e-3f);
+const Vector4 b(3.3f, 0.7f, -2.9f, 1.1e5f);
+
+}
+
+SimdTest::SimdTest() {
+    addTests({&SimdTest::vectorArithmetic,
+              &SimdTest::vectorNegateZero,
+              &SimdTest::vectorDot,
+              &SimdTest::matrixMultiply,
+              &SimdTest::matrixTransform,
+              &SimdTest::quaternionMultiply});
+}
+
+void SimdTest::vectorArithmetic() {
+    Vector4 add, sub, mul, div, mulScalar, divScalar;
+    for(std::size_t i = 0; i != 4; ++i) {
+        add[i] = a[i] + b[i];
+        sub[i] = a[i] - b[i];
+        mul[i] = a[i]*b[i];
+        div[i] = a[i]/b[i];
+        mulScalar[i] = a[i]*0.3f;
+        divScalar[i] = a[i]/0.3f;
+    }
+
+    CORRADE_VERIFY(bitEqual(a + b, add));
+    CORRADE_VERIFY(bitEqual(a - b, sub));
+    CORRADE_VERIFY(bitEqual(a*b, mul));
+    CORRADE_VERIFY(bitEqual(a/b, div));
+    CORRADE_VERIFY(bitEqual(a*0.3f, mulScalar));
+    CORRADE_VERIFY(bitEqual(a/0.3f, divScalar));
+}
+
+void SimdTest::vectorNegateZero() {
+    const Vector4 negated = -Vector4(0.0f, -0.0f, 1.0f, -1.0f);
+    CORRADE_VERIFY(std::signbit(negated[0]));
+    CORRADE_VERIFY(!std::signbit(negated[1]));
+    CORRADE_VERIFY(bitEqual(negated[2], -1.0f));
+    CORRADE_VERIFY(bitEqual(negated[3], 1.0f));
+}
+
+void SimdTest::vectorDot() {
+    const Float expected = a[0]*b[0] + a[1]*b[1] + a[2]*b[2] + a[3]*b[3];
+    CORRADE_VERIFY(bitEqual(Vector4::dot(a, b), expected));
+}
+
+void SimdTest::matrixMultiply() {
+    const Matrix4 m = Matrix4::rotation(Deg<Float>(37.0f), Vector3(0.1f, 0.7f, -0.3f).normalized())*Matrix4::translation({0.3f, -1.7f, 2.2f});
+    const Matrix4 n = Matrix4::perspectiveProjection(Deg<Float>(35.0f), 1.33f, 0.01f, 100.0f)*Matrix4::scaling({0.3f, 1.1f, 7.0f});
+
+    Matrix4 expected{Matrix4::Zero};
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 4; ++row)
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                expected[col][row] += m[pos][row]*n[col][pos];
+
+    CORRADE_VERIFY(bitEqual(m*n, expected));
+}
+
+void SimdTest::matrixTransform() {
+    const Matrix4 m = Matrix4::rotation(Deg<Float>(37.0f), Vector3(0.1f, 0.7f, -0.3f).normalized())*Matrix4::translation({0.3f, -1.7f, 2.2f});
+
+    Vector4 expected;
+    for(std::size_t row = 0; row != 4; ++row)
+        for(std::size_t pos = 0; pos != 4; ++pos)
+            expected[row] += m[pos][row]*a[pos];
+
+    CORRADE_VERIFY(bitEqual(m*a, expected));
+}
+
+void SimdTest::quaternionMultiply() {
+    const Quaternion p{{0.1f, -0.3f, 0.7f}, 0.2f};
+    const Quaternion q{{-1.1f, 0.6f, 0.3f}, -0.9f};
+
+    const Vector3 pv = p.vector(), qv = q.vector();
+    Vector3 vector;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const std::size_t j = (i + 1) % 3, k = (i + 2) % 3;
+        vector[i] = qv[i]*p.scalar() + pv[i]*q.scalar() + (pv[j]*qv[k] - pv[k]*qv[j]);
+    }
+    const Float scalar = p.scalar()*q.scalar() - (pv[0]*qv[0] + pv[1]*qv[1] + pv[2]*qv[2]);
+
+    const Quaternion result = p*q;
+    CORRADE_VERIFY(bitEqual(result.vector(), vector));
+    CORRADE_VERIFY(bitEqual(result.scalar(), scalar));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdTest)
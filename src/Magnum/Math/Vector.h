@@ -40,10 +40,53 @@
 #include "Magnum/Math/BoolVector.h"
 #include "Magnum/Math/TypeTraits.h"
 
+/* SIMD backend, selected based on what the compiler targets. Only
+   instruction sets where the float operations are IEEE-compliant (i.e.
+   bit-exact with the scalar code) are used, thus not NEON on 32-bit ARM. */
+#ifdef MAGNUM_MATH_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNUM_MATH_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define MAGNUM_MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t, class, class> struct VectorConverter;
+
+    #ifdef MAGNUM_MATH_SIMD_SSE2
+    typedef __m128 Float4;
+    inline Float4 float4Load(const Float* data) { return _mm_loadu_ps(data); }
+    inline void float4Store(Float* data, Float4 value) { _mm_storeu_ps(data, value); }
+    inline Float4 float4Set(Float x, Float y, Float z, Float w) { return _mm_setr_ps(x, y, z, w); }
+    inline Float4 float4Splat(Float value) { return _mm_set1_ps(value); }
+    inline Float4 float4Zero() { return _mm_setzero_ps(); }
+    inline Float4 float4Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+    inline Float4 float4Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+    inline Float4 float4Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+    inline Float4 float4Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+    /* Flipping the sign bit, subtracting from zero would turn +0 to +0 */
+    inline Float4 float4Negate(Float4 a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+    #elif defined(MAGNUM_MATH_SIMD_NEON)
+    typedef float32x4_t Float4;
+    inline Float4 float4Load(const Float* data) { return vld1q_f32(data); }
+    inline void float4Store(Float* data, Float4 value) { vst1q_f32(data, value); }
+    inline Float4 float4Set(Float x, Float y, Float z, Float w) {
+        const Float data[]{x, y, z, w};
+        return vld1q_f32(data);
+    }
+    inline Float4 float4Splat(Float value) { return vdupq_n_f32(value); }
+    inline Float4 float4Zero() { return vdupq_n_f32(0.0f); }
+    inline Float4 float4Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+    inline Float4 float4Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+    inline Float4 float4Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+    inline Float4 float4Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+    inline Float4 float4Negate(Float4 a) { return vnegq_f32(a); }
+    #endif
 }
 
 /**
@@ -1309,6 +1352,53 @@ template<std::size_t size, class T> inline T Vector<size, T>::max() const {
     return out;
 }
 
+#if defined(MAGNUM_MATH_SIMD_SSE2) || defined(MAGNUM_MATH_SIMD_NEON)
+/* SIMD specializations for four-component float vectors. The operations are
+   done in the same order as in the scalar code, so the results are the same
+   to the last bit. */
+template<> inline Float Vector<4, Float>::dot(const Vector<4, Float>& a, const Vector<4, Float>& b) {
+    Float products[4];
+    Implementation::float4Store(products, Implementation::float4Mul(Implementation::float4Load(a._data), Implementation::float4Load(b._data)));
+    return products[0] + products[1] + products[2] + products[3];
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator+=(const Vector<4, Float>& other) {
+    Implementation::float4Store(_data, Implementation::float4Add(Implementation::float4Load(_data), Implementation::float4Load(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator-=(const Vector<4, Float>& other) {
+    Implementation::float4Store(_data, Implementation::float4Sub(Implementation::float4Load(_data), Implementation::float4Load(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Float number) {
+    Implementation::float4Store(_data, Implementation::float4Mul(Implementation::float4Load(_data), Implementation::float4Splat(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Float number) {
+    Implementation::float4Store(_data, Implementation::float4Div(Implementation::float4Load(_data), Implementation::float4Splat(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Vector<4, Float>& other) {
+    Implementation::float4Store(_data, Implementation::float4Mul(Implementation::float4Load(_data), Implementation::float4Load(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Vector<4, Float>& other) {
+    Implementation::float4Store(_data, Implementation::float4Div(Implementation::float4Load(_data), Implementation::float4Load(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::operator-() const {
+    Vector<4, Float> out;
+    Implementation::float4Store(out._data, Implementation::float4Negate(Implementation::float4Load(_data)));
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
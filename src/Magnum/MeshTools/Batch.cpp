@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Batch.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Transform.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::tuple<Trade::MeshData3D, std::vector<BatchRange>> batch(const std::vector<std::reference_wrapper<const Trade::MeshData3D>>& meshes, const std::vector<Matrix4>& transformations) {
+    CORRADE_ASSERT(!meshes.empty(), "MeshTools::batch(): no meshes passed",
+        std::make_tuple(Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}, std::vector<BatchRange>{}));
+    CORRADE_ASSERT(transformations.empty() || transformations.size() == meshes.size(), "MeshTools::batch(): expected" << meshes.size() << "transformations but got" << transformations.size(),
+        std::make_tuple(Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}, std::vector<BatchRange>{}));
+
+    /* Check the layout and calculate final size */
+    const Trade::MeshData3D& first = meshes.front();
+    bool indexed = false;
+    std::size_t indexCount = 0, vertexCount = 0;
+    for(const Trade::MeshData3D& mesh: meshes) {
+        CORRADE_ASSERT(mesh.primitive() == first.primitive() && mesh.hasNormals() == first.hasNormals() && mesh.hasTextureCoords2D() == first.hasTextureCoords2D(),
+            "MeshTools::batch(): all meshes must have the same primitive and attributes",
+            std::make_tuple(Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}, std::vector<BatchRange>{}));
+
+        indexed = indexed || mesh.isIndexed();
+        indexCount += mesh.isIndexed() ? mesh.indices().size() : mesh.positions(0).size();
+        vertexCount += mesh.positions(0).size();
+    }
+
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions, normals;
+    std::vector<Vector2> textureCoords2D;
+    if(indexed) indices.reserve(indexCount);
+    positions.reserve(vertexCount);
+    if(first.hasNormals()) normals.reserve(vertexCount);
+    if(first.hasTextureCoords2D()) textureCoords2D.reserve(vertexCount);
+
+    std::vector<BatchRange> ranges;
+    ranges.reserve(meshes.size());
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData3D& mesh = meshes[i];
+        const std::vector<Vector3>& meshPositions = mesh.positions(0);
+        const UnsignedInt vertexOffset = positions.size();
+
+        /* Indices, offset by base vertex */
+        const UnsignedInt indexOffset = indices.size();
+        if(indexed) {
+            if(mesh.isIndexed()) for(UnsignedInt index: mesh.indices())
+                indices.push_back(vertexOffset + index);
+            else for(std::size_t j = 0; j != meshPositions.size(); ++j)
+                indices.push_back(vertexOffset + j);
+        }
+
+        /* Vertex data */
+        positions.insert(positions.end(), meshPositions.begin(), meshPositions.end());
+        if(mesh.hasNormals())
+            normals.insert(normals.end(), mesh.normals(0).begin(), mesh.normals(0).end());
+        if(mesh.hasTextureCoords2D())
+            textureCoords2D.insert(textureCoords2D.end(), mesh.textureCoords2D(0).begin(), mesh.textureCoords2D(0).end());
+
+        /* Pre-transform, normals need the inverse transpose to handle
+           non-uniform scaling */
+        if(!transformations.empty()) {
+            const std::size_t count = meshPositions.size();
+            transformPointsInPlace(transformations[i], {reinterpret_cast<char*>(positions.data() + vertexOffset), count*sizeof(Vector3)}, sizeof(Vector3), count);
+            if(mesh.hasNormals()) {
+                const Matrix4 normalMatrix = Matrix4::from(transformations[i].rotationScaling().inverted().transposed(), {});
+                transformVectorsInPlace(normalMatrix, {reinterpret_cast<char*>(normals.data() + vertexOffset), count*sizeof(Vector3)}, sizeof(Vector3), count);
+                for(std::size_t j = vertexOffset; j != normals.size(); ++j)
+                    normals[j] = normals[j].normalized();
+            }
+        }
+
+        ranges.push_back({indexOffset, UnsignedInt(indices.size() - indexOffset), vertexOffset, UnsignedInt(meshPositions.size())});
+    }
+
+    return std::make_tuple(Trade::MeshData3D{first.primitive(), std::move(indices), {std::move(positions)},
+        first.hasNormals() ? std::vector<std::vector<Vector3>>{std::move(normals)} : std::vector<std::vector<Vector3>>{},
+        first.hasTextureCoords2D() ? std::vector<std::vector<Vector2>>{std::move(textureCoords2D)} : std::vector<std::vector<Vector2>>{}},
+        std::move(ranges));
+}
+
+}}
@@ -0,0 +1,91 @@
+#ifndef Magnum_MeshTools_Batch_h
+#define Magnum_MeshTools_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::BatchRange, function @ref Magnum::MeshTools::batch()
+ */
+
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Range of batched mesh
+
+Position of one of the original meshes in the data produced by @ref batch().
+The indices are already offset by @ref vertexOffset, so the range can be
+drawn directly using @ref MeshView::setIndexRange(), or
+@ref MeshView::setVertexRange() if the batch is not indexed.
+@see @ref compile(const Trade::MeshData3D&, const std::vector<BatchRange>&, BufferUsage)
+*/
+struct BatchRange {
+    UnsignedInt indexOffset;    /**< @brief Offset of first index */
+    UnsignedInt indexCount;     /**< @brief Index count */
+    UnsignedInt vertexOffset;   /**< @brief Offset of first vertex (base vertex) */
+    UnsignedInt vertexCount;    /**< @brief Vertex count */
+};
+
+/**
+@brief Concatenate many meshes into one
+@param meshes           Meshes to batch
+@param transformations  Transformations to apply to the meshes, or empty
+    array for no transformation
+@return Batched mesh data and range of each original mesh in them
+
+Concatenates first position, normal and texture coordinate array of all
+meshes into one mesh, so they can share the same vertex and index buffer and
+be drawn with just changing the index range, see
+@ref compile(const Trade::MeshData3D&, const std::vector<BatchRange>&, BufferUsage).
+If @p transformations are present, positions of each mesh are transformed
+using @ref transformPointsInPlace() and normals using the normal matrix, so
+static geometry can be drawn with single transformation. If any mesh is
+indexed, trivial index array is generated for the non-indexed ones. Example
+usage:
+@code
+std::vector<std::reference_wrapper<const Trade::MeshData3D>> props;
+std::vector<Matrix4> transformations;
+
+Trade::MeshData3D data{MeshPrimitive::Triangles, {}, {{}}, {}, {}};
+std::vector<MeshTools::BatchRange> ranges;
+std::tie(data, ranges) = MeshTools::batch(props, transformations);
+@endcode
+
+@attention All meshes must have the same primitive and the same set of
+    attributes. If @p transformations are not empty, their count must be
+    the same as mesh count.
+*/
+std::tuple<Trade::MeshData3D, std::vector<BatchRange>> MAGNUM_MESHTOOLS_EXPORT batch(const std::vector<std::reference_wrapper<const Trade::MeshData3D>>& meshes, const std::vector<Matrix4>& transformations = {});
+
+}}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BoundingVolume.h"
+
+#include <tuple>
+#include <utility>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace MeshTools {
+
+Range3D boundingRange(const std::vector<Vector3>& positions) {
+    if(positions.empty()) return {};
+
+    const std::pair<Vector3, Vector3> minmax = Math::minmax(Math::StridedArrayReference<const Vector3>{positions.data(), positions.size()});
+    return {minmax.first, minmax.second};
+}
+
+std::pair<Vector3, Float> boundingSphere(const std::vector<Vector3>& positions) {
+    if(positions.empty()) return {{}, 0.0f};
+
+    /* Extremal points along axes and space diagonals */
+    constexpr Vector3 directions[]{
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 1.0f, 1.0f},
+        {1.0f, 1.0f, -1.0f},
+        {1.0f, -1.0f, 1.0f},
+        {1.0f, -1.0f, -1.0f}
+    };
+    constexpr std::size_t DirectionCount = sizeof(directions)/sizeof(Vector3);
+    std::size_t minIndex[DirectionCount]{}, maxIndex[DirectionCount]{};
+    Float minDistance[DirectionCount], maxDistance[DirectionCount];
+    for(std::size_t i = 0; i != DirectionCount; ++i)
+        minDistance[i] = maxDistance[i] = Vector3::dot(positions[0], directions[i]);
+    for(std::size_t i = 1; i != positions.size(); ++i) {
+        for(std::size_t j = 0; j != DirectionCount; ++j) {
+            const Float distance = Vector3::dot(positions[i], directions[j]);
+            if(distance < minDistance[j]) {
+                minDistance[j] = distance;
+                minIndex[j] = i;
+            }
+            if(distance > maxDistance[j]) {
+                maxDistance[j] = distance;
+                maxIndex[j] = i;
+            }
+        }
+    }
+
+    /* Initial sphere spanned between the most distant pair */
+    std::size_t initial = 0;
+    Float initialDistance = -1.0f;
+    for(std::size_t i = 0; i != DirectionCount; ++i) {
+        const Float distance = (positions[maxIndex[i]] - positions[minIndex[i]]).dot();
+        if(distance > initialDistance) {
+            initialDistance = distance;
+            initial = i;
+        }
+    }
+    Vector3 center = (positions[minIndex[initial]] + positions[maxIndex[initial]])*0.5f;
+    Float radius = std::sqrt(initialDistance)*0.5f;
+
+    /* Grow the sphere to contain all points */
+    Float radiusSquared = radius*radius;
+    for(const Vector3& position: positions) {
+        const Float distanceSquared = (position - center).dot();
+        if(distanceSquared <= radiusSquared) continue;
+
+        const Float distance = std::sqrt(distanceSquared);
+        const Float newRadius = (radius + distance)*0.5f;
+        center += (position - center)*((newRadius - radius)/distance);
+        radius = newRadius;
+        radiusSquared = radius*radius;
+    }
+
+    return {center, radius};
+}
+
+Matrix4 boundingBoxOriented(const std::vector<Vector3>& positions) {
+    if(positions.empty()) return Matrix4{Matrix4::Zero};
+
+    /* Covariance matrix */
+    Vector3 mean;
+    for(const Vector3& position: positions) mean += position;
+    mean /= Float(positions.size());
+    Matrix3x3 covariance(Matrix3x3::Zero);
+    for(const Vector3& position: positions) {
+        const Vector3 d = position - mean;
+        covariance[0] += d*d.x();
+        covariance[1] += d*d.y();
+        covariance[2] += d*d.z();
+    }
+
+    /* Principal axes sorted by variance, make them right-handed. If SVD
+       didn't converge, the axes are zero, use coordinate axes instead. */
+    Vector3 variance;
+    Matrix3x3 axes;
+    std::tie(std::ignore, variance, axes) = Math::Algorithms::svd(covariance);
+    if(axes == Matrix3x3(Matrix3x3::Zero)) axes = Matrix3x3();
+    for(std::size_t i = 0; i != 2; ++i) for(std::size_t j = i + 1; j != 3; ++j) {
+        if(variance[j] <= variance[i]) continue;
+        std::swap(variance[i], variance[j]);
+        std::swap(axes[i], axes[j]);
+    }
+    if(Vector3::dot(Vector3::cross(axes[0], axes[1]), axes[2]) < 0.0f)
+        axes[2] = -axes[2];
+
+    /* Extents in the rotated frame */
+    const Matrix3x3 toLocal = axes.transposed();
+    Vector3 min = toLocal*positions[0], max = min;
+    for(const Vector3& position: positions) {
+        const Vector3 local = toLocal*position;
+        min = Math::min(min, local);
+        max = Math::max(max, local);
+    }
+
+    return Matrix4::from(axes*Matrix3x3::fromDiagonal((max - min)*0.5f), axes*((min + max)*0.5f));
+}
+
+}}
@@ -0,0 +1,86 @@
+#ifndef Magnum_MeshTools_BoundingVolume_h
+#define Magnum_MeshTools_BoundingVolume_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::boundingRange(), @ref Magnum::MeshTools::boundingSphere(), @ref Magnum::MeshTools::boundingBoxOriented()
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Axis-aligned bounding box
+@param positions    Vertex positions
+
+Returns range containing all positions, suitable e.g. for frustum culling.
+If @p positions are empty, returns zero range at origin.
+@see @ref boundingSphere(), @ref boundingBoxOriented()
+*/
+Range3D MAGNUM_MESHTOOLS_EXPORT boundingRange(const std::vector<Vector3>& positions);
+
+/**
+@brief Bounding sphere
+@param positions    Vertex positions
+
+Returns center and radius of a sphere containing all positions. The initial
+sphere is spanned between the two most distant extremal points along the
+coordinate axes and the four space diagonals, then it is grown to contain all
+points using Ritter's algorithm. The result is usually within a few percent of
+the minimal bounding sphere and is computed in two passes over the data. If
+@p positions are empty, returns zero-sized sphere at origin. The result can be
+passed to e.g. @ref Shapes::Sphere constructor.
+@see @ref boundingRange(), @ref boundingBoxOriented()
+*/
+std::pair<Vector3, Float> MAGNUM_MESHTOOLS_EXPORT boundingSphere(const std::vector<Vector3>& positions);
+
+/**
+@brief Oriented bounding box
+@param positions    Vertex positions
+
+Box axes are principal components of the positions, i.e. eigenvectors of their
+covariance matrix computed using @ref Math::Algorithms::svd(), ordered by
+decreasing variance. The returned transformation is composed of the
+(right-handed) rotation, scaling by half extents and translation to box center,
+so it transforms the unit box to the bounding box. Tighter than
+@ref boundingRange() for elongated meshes not aligned with coordinate axes. If
+@p positions are empty, returns zero matrix. The result can be passed to e.g.
+@ref Shapes::Box constructor or
+@ref Math::Geometry::Intersection::boxFrustum().
+@see @ref boundingSphere()
+*/
+Matrix4 MAGNUM_MESHTOOLS_EXPORT boundingBoxOriented(const std::vector<Vector3>& positions);
+
+}}
+
+#endif
@@ -0,0 +1,168 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BuildMeshlets.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Ritter's bounding sphere of meshlet vertices */
+void meshletBounds(Meshlet& meshlet, const std::vector<UnsignedInt>& meshletVertices, const std::vector<Vector3>& positions) {
+    const UnsignedInt* const vertices = meshletVertices.data() + meshlet.vertexOffset;
+
+    /* Find point farthest from arbitrary point, then point farthest from
+       that one and make initial sphere from these two */
+    const Vector3& first = positions[vertices[0]];
+    Vector3 a = first, b = first;
+    Float distance = 0.0f;
+    for(UnsignedInt i = 0; i != meshlet.vertexCount; ++i) {
+        const Float d = (positions[vertices[i]] - first).dot();
+        if(d > distance) {
+            distance = d;
+            a = positions[vertices[i]];
+        }
+    }
+    distance = 0.0f;
+    for(UnsignedInt i = 0; i != meshlet.vertexCount; ++i) {
+        const Float d = (positions[vertices[i]] - a).dot();
+        if(d > distance) {
+            distance = d;
+            b = positions[vertices[i]];
+        }
+    }
+    meshlet.center = (a + b)*0.5f;
+    meshlet.radius = std::sqrt(distance)*0.5f;
+
+    /* Grow the sphere to contain all points */
+    for(UnsignedInt i = 0; i != meshlet.vertexCount; ++i) {
+        const Vector3 direction = positions[vertices[i]] - meshlet.center;
+        const Float d = direction.length();
+        if(d <= meshlet.radius) continue;
+
+        const Float radius = (meshlet.radius + d)*0.5f;
+        meshlet.center += direction*((radius - meshlet.radius)/d);
+        meshlet.radius = radius;
+    }
+}
+
+/* Normal cone of meshlet triangles */
+void meshletCone(Meshlet& meshlet, const std::vector<UnsignedInt>& meshletVertices, const std::vector<UnsignedByte>& meshletTriangles, const std::vector<Vector3>& positions) {
+    const UnsignedInt* const vertices = meshletVertices.data() + meshlet.vertexOffset;
+    const UnsignedByte* const triangles = meshletTriangles.data() + meshlet.triangleOffset;
+
+    /* Average of unit triangle normals */
+    Vector3 axis;
+    for(UnsignedInt i = 0; i != meshlet.triangleCount*3; i += 3) {
+        const Vector3& a = positions[vertices[triangles[i]]];
+        const Vector3 normal = Vector3::cross(positions[vertices[triangles[i+1]]] - a, positions[vertices[triangles[i+2]]] - a);
+        const Float length = normal.length();
+        if(length != 0.0f) axis += normal/length;
+    }
+
+    /* Degenerate cone, can't be culled */
+    meshlet.coneCutoff = 1.0f;
+    const Float axisLength = axis.length();
+    if(axisLength == 0.0f) return;
+    meshlet.coneAxis = axis/axisLength;
+
+    /* Cosine of the largest angle between normal and the axis */
+    Float minDot = 1.0f;
+    for(UnsignedInt i = 0; i != meshlet.triangleCount*3; i += 3) {
+        const Vector3& a = positions[vertices[triangles[i]]];
+        const Vector3 normal = Vector3::cross(positions[vertices[triangles[i+1]]] - a, positions[vertices[triangles[i+2]]] - a);
+        const Float length = normal.length();
+        if(length != 0.0f) minDot = std::min(minDot, Vector3::dot(normal/length, meshlet.coneAxis));
+    }
+
+    /* The cone spans more than a hemisphere, can't be culled */
+    if(minDot <= 0.0f) return;
+    meshlet.coneCutoff = std::sqrt(1.0f - minDot*minDot);
+}
+
+}
+
+std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>> buildMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::buildMeshlets(): index count is not divisible by 3!", (std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>>()));
+    CORRADE_ASSERT(maxVertices >= 3 && maxVertices <= 256 && maxTriangles >= 1, "MeshTools::buildMeshlets(): expected 3 to 256 vertices and at least one triangle, got" << maxVertices << "and" << maxTriangles, (std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>>()));
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> meshletVertices;
+    std::vector<UnsignedByte> meshletTriangles;
+    meshletTriangles.reserve(indices.size());
+
+    /* Local index of each vertex in current meshlet */
+    constexpr UnsignedInt NotInMeshlet = std::numeric_limits<UnsignedInt>::max();
+    std::vector<UnsignedInt> localIndex(positions.size(), NotInMeshlet);
+
+    Meshlet meshlet{};
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        /* Count vertices not yet in the meshlet */
+        UnsignedInt newVertexCount = 0;
+        for(std::size_t j = 0; j != 3; ++j) {
+            CORRADE_ASSERT(indices[i+j] < positions.size(), "MeshTools::buildMeshlets(): index out of range", (std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>>()));
+            if(localIndex[indices[i+j]] == NotInMeshlet) ++newVertexCount;
+        }
+
+        /* The triangle doesn't fit, finish current meshlet */
+        if(meshlet.vertexCount + newVertexCount > maxVertices || meshlet.triangleCount == maxTriangles) {
+            for(UnsignedInt j = 0; j != meshlet.vertexCount; ++j)
+                localIndex[meshletVertices[meshlet.vertexOffset + j]] = NotInMeshlet;
+            meshlets.push_back(meshlet);
+
+            meshlet = Meshlet{};
+            meshlet.vertexOffset = meshletVertices.size();
+            meshlet.triangleOffset = meshletTriangles.size();
+        }
+
+        /* Add the triangle */
+        for(std::size_t j = 0; j != 3; ++j) {
+            UnsignedInt& local = localIndex[indices[i+j]];
+            if(local == NotInMeshlet) {
+                local = meshlet.vertexCount++;
+                meshletVertices.push_back(indices[i+j]);
+            }
+            meshletTriangles.push_back(local);
+        }
+        ++meshlet.triangleCount;
+    }
+
+    /* Last meshlet */
+    if(meshlet.triangleCount) meshlets.push_back(meshlet);
+
+    /* Calculate bounds and normal cones */
+    for(Meshlet& m: meshlets) {
+        meshletBounds(m, meshletVertices, positions);
+        meshletCone(m, meshletVertices, meshletTriangles, positions);
+    }
+
+    return std::make_tuple(std::move(meshlets), std::move(meshletVertices), std::move(meshletTriangles));
+}
+
+}}
@@ -0,0 +1,120 @@
+#ifndef Magnum_MeshTools_BuildMeshlets_h
+#define Magnum_MeshTools_BuildMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, function @ref Magnum::MeshTools::buildMeshlets(), @ref Magnum::MeshTools::isMeshletBackfacing()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Cluster of triangles produced by @ref buildMeshlets(). Vertices of the
+meshlet are `vertexCount` items starting at `vertexOffset` in the meshlet
+vertex array, its triangles are `triangleCount*3` local 8-bit indices (into
+the meshlet vertices) starting at `triangleOffset` in the meshlet triangle
+array.
+*/
+struct Meshlet {
+    UnsignedInt vertexOffset;   /**< @brief Offset into meshlet vertex array */
+    UnsignedInt triangleOffset; /**< @brief Offset into meshlet triangle array */
+    UnsignedInt vertexCount;    /**< @brief Vertex count */
+    UnsignedInt triangleCount;  /**< @brief Triangle count */
+
+    Vector3 center;             /**< @brief Bounding sphere center */
+    Float radius;               /**< @brief Bounding sphere radius */
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Average direction of triangle normals.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the angle between @ref coneAxis and the most deviating
+     * triangle normal. Value of `1.0f` means that the meshlet can't be
+     * culled based on normal cone.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Split the mesh into meshlets
+@param indices      Triangle index array
+@param positions    Vertex positions
+@param maxVertices  Max vertex count of one meshlet, at most `256`
+@param maxTriangles Max triangle count of one meshlet
+@return Meshlets, meshlet vertex array and meshlet triangle array
+
+Goes through the triangles in order and adds them to current meshlet until
+either the vertex or triangle limit is reached. As this preserves locality of
+the input, you might want to optimize the mesh using @ref tipsify() first.
+The meshlet vertex array contains indices into original vertex data, meshlet
+triangle array contains triangle indices local to each meshlet. Each meshlet
+has bounding sphere and normal cone, which can be used for culling whole
+meshlets on the CPU, see @ref isMeshletBackfacing(). Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<MeshTools::Meshlet> meshlets;
+std::vector<UnsignedInt> meshletVertices;
+std::vector<UnsignedByte> meshletTriangles;
+std::tie(meshlets, meshletVertices, meshletTriangles) = MeshTools::buildMeshlets(indices, positions);
+@endcode
+
+@attention Index count must be divisible by 3.
+*/
+std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>> MAGNUM_MESHTOOLS_EXPORT buildMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 126);
+
+/**
+@brief Whether all triangles of given meshlet are facing away from camera
+
+Conservative test using meshlet normal cone and bounding sphere, returns
+`false` if any triangle might be visible. Counterclockwise triangle winding
+is expected.
+*/
+inline bool isMeshletBackfacing(const Meshlet& meshlet, const Vector3& cameraPosition) {
+    if(meshlet.coneCutoff >= 1.0f) return false;
+    const Vector3 direction = meshlet.center - cameraPosition;
+    return Vector3::dot(direction, meshlet.coneAxis) >= meshlet.coneCutoff*direction.length() + meshlet.radius;
+}
+
+}}
+
+#endif
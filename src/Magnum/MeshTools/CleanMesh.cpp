@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CleanMesh.h"
+
+#include <unordered_set>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+struct TriangleHash {
+    std::size_t operator()(const Math::Vector3<UnsignedInt>& triangle) const {
+        return (std::size_t(triangle[0])*73856093)^(std::size_t(triangle[1])*19349663)^(std::size_t(triangle[2])*83492791);
+    }
+};
+
+}
+
+std::vector<UnsignedInt> cleanMesh(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, const Float areaEpsilon) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::cleanMesh(): index count is not divisible by 3", {});
+
+    /* Remove degenerate and duplicate triangles, compacting the indices in
+       place */
+    std::unordered_set<Math::Vector3<UnsignedInt>, TriangleHash> triangles;
+    triangles.reserve(indices.size()/3);
+    std::size_t triangleCount = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        CORRADE_ASSERT(a < positions.size() && b < positions.size() && c < positions.size(),
+            "MeshTools::cleanMesh(): index out of range", {});
+        if(a == b || b == c || c == a) continue;
+
+        /* Twice the area */
+        if(Vector3::cross(positions[b] - positions[a], positions[c] - positions[a]).length() <= 2.0f*areaEpsilon)
+            continue;
+
+        /* Rotate the smallest index first so rotated triangles compare
+           equal, keeping the winding */
+        Math::Vector3<UnsignedInt> triangle;
+        if(a < b && a < c) triangle = {a, b, c};
+        else if(b < c) triangle = {b, c, a};
+        else triangle = {c, a, b};
+        if(!triangles.insert(triangle).second) continue;
+
+        indices[triangleCount*3] = a;
+        indices[triangleCount*3 + 1] = b;
+        indices[triangleCount*3 + 2] = c;
+        ++triangleCount;
+    }
+    indices.resize(triangleCount*3);
+
+    /* Renumber the vertices in order of first use */
+    constexpr UnsignedInt Unused = ~UnsignedInt{};
+    std::vector<UnsignedInt> remap(positions.size(), Unused);
+    std::vector<UnsignedInt> mapping;
+    for(UnsignedInt& index: indices) {
+        if(remap[index] == Unused) {
+            remap[index] = mapping.size();
+            mapping.push_back(index);
+        }
+        index = remap[index];
+    }
+
+    /* Compact the positions */
+    std::vector<Vector3> outPositions;
+    outPositions.reserve(mapping.size());
+    for(UnsignedInt index: mapping) outPositions.push_back(positions[index]);
+    positions = std::move(outPositions);
+
+    return mapping;
+}
+
+}}
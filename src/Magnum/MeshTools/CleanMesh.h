@@ -0,0 +1,75 @@
+#ifndef Magnum_MeshTools_CleanMesh_h
+#define Magnum_MeshTools_CleanMesh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::cleanMesh()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Remove degenerate and duplicate triangles and unused vertices
+@param[in,out] indices      Triangle index array
+@param[in,out] positions    Vertex positions
+@param[in] areaEpsilon      Triangles with area not larger than this value
+    are considered degenerate
+@return Vertex mapping
+
+Single linear pass which removes triangles referencing the same vertex more
+than once, triangles with zero (or not larger than @p areaEpsilon) area and
+triangles which are the same as some previous triangle, including rotation of
+its indices. Triangles with opposite winding are kept, as they are commonly
+used for double-sided geometry. Order of remaining triangles is preserved.
+
+Then the vertices not referenced by any remaining triangle are removed from
+@p positions and the rest is reordered in order of first use, which also
+improves vertex fetch locality. The returned array contains original index of
+each remaining vertex, use @ref duplicate() to compact the other vertex
+attributes the same way:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+
+std::vector<UnsignedInt> mapping = MeshTools::cleanMesh(indices, positions);
+normals = MeshTools::duplicate(mapping, normals);
+@endcode
+
+@attention Index count must be divisible by 3 and all indices must be in
+    range of @p positions.
+@see @ref removeDuplicates()
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT cleanMesh(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, Float areaEpsilon = 0.0f);
+
+}}
+
+#endif
@@ -26,11 +26,10 @@
 #include "CombineIndexedArrays.h"
 
 #include <cstring>
-#include <unordered_map>
 #include <Corrade/Utility/Assert.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/Implementation/Hash.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -87,74 +86,86 @@ std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::ve
 
 namespace {
 
-class IndexHash {
-    public:
-        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        std::size_t operator()(UnsignedInt key) const {
-            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
+/* Specialized hashes for the most common cases (position + normal or
+   position + normal + texture coordinates) and generic fallback */
+struct IndexHash2 {
+    UnsignedLong operator()(const UnsignedInt* const data, UnsignedInt) const {
+        return Implementation::mix(UnsignedLong(data[0]) | (UnsignedLong(data[1]) << 32));
+    }
 };
 
-class IndexEqual {
-    public:
-        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        bool operator()(UnsignedInt a, UnsignedInt b) const {
-            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
+struct IndexHash3 {
+    UnsignedLong operator()(const UnsignedInt* const data, UnsignedInt) const {
+        return Implementation::mix((UnsignedLong(data[0]) | (UnsignedLong(data[1]) << 32)) ^ (UnsignedLong(data[2])*0x9e3779b97f4a7c15ull));
+    }
 };
 
-}
+struct IndexHash {
+    UnsignedLong operator()(const UnsignedInt* const data, const UnsignedInt stride) const {
+        UnsignedLong hash = 0;
+        for(UnsignedInt i = 0; i != stride; ++i)
+            hash = Implementation::mix(hash ^ data[i]);
+        return hash;
+    }
+};
 
-std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
-    CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
-    CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
+template<class Hash> std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combine(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
+    const std::size_t count = interleavedArrays.size()/stride;
 
-    /* Hash map with index combinations, containing just indices into
-       interleavedArrays vector, hashing and comparison is done using IndexHash
-       and IndexEqual functors. Reserving more buckets than necessary (i.e. as
-       if each combination was unique). */
-    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
-        interleavedArrays.size()/stride,
-        IndexHash(interleavedArrays, stride),
-        IndexEqual(interleavedArrays, stride));
+    /* Open-addressing table with linear probing, containing indices into
+       newInterleavedArrays. Power-of-two size with load factor at most 0.5
+       (i.e. as if each combination was unique). */
+    std::size_t capacity = 16;
+    while(capacity < count*2) capacity *= 2;
+    const std::size_t mask = capacity - 1;
+    constexpr UnsignedInt Empty = ~UnsignedInt{};
+    std::vector<UnsignedInt> table(capacity, Empty);
 
     /* Make the index combinations unique. Original indices into original
        `interleavedArrays` array were 0, 1, 2, 3, ..., `combinedIndices`
-       contains new ones into new (shorter) `newInterleavedArrays` array. */
+       contains new ones into new (shorter) `newInterleavedArrays` array. Both
+       outputs are reserved for the worst case to avoid reallocations. */
     std::vector<UnsignedInt> combinedIndices;
-    combinedIndices.reserve(interleavedArrays.size()/stride);
+    combinedIndices.reserve(count);
     std::vector<UnsignedInt> newInterleavedArrays;
-    for(std::size_t oldIndex = 0, end = interleavedArrays.size()/stride; oldIndex != end; ++oldIndex) {
-        /* Try to insert new index combination to the map */
-        #ifndef CORRADE_GCC46_COMPATIBILITY
-        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
-        #else
-        const auto result = indexCombinations.insert({oldIndex, indexCombinations.size()});
-        #endif
+    newInterleavedArrays.reserve(interleavedArrays.size());
+    const Hash hash;
+    for(std::size_t oldIndex = 0; oldIndex != count; ++oldIndex) {
+        const UnsignedInt* const combination = interleavedArrays.data() + oldIndex*stride;
 
-        /* Add the (either new or already existing) index to resulting index array */
-        combinedIndices.push_back(result.first->second);
+        /* Find either the same combination or empty slot */
+        std::size_t slot = hash(combination, stride) & mask;
+        while(table[slot] != Empty && std::memcmp(newInterleavedArrays.data() + table[slot]*stride, combination, sizeof(UnsignedInt)*stride) != 0)
+            slot = (slot + 1) & mask;
 
         /* If this is new combination, copy it to new interleaved arrays */
-        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
-            interleavedArrays.begin()+oldIndex*stride,
-            interleavedArrays.begin()+(oldIndex+1)*stride);
+        if(table[slot] == Empty) {
+            table[slot] = newInterleavedArrays.size()/stride;
+            newInterleavedArrays.insert(newInterleavedArrays.end(), combination, combination + stride);
+        }
+
+        /* Add the (either new or already existing) index to resulting index array */
+        combinedIndices.push_back(table[slot]);
     }
 
-    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == interleavedArrays.size()/stride &&
+    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == count &&
                             newInterleavedArrays.size() <= interleavedArrays.size());
 
     return {std::move(combinedIndices), std::move(newInterleavedArrays)};
 }
 
+}
+
+std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
+    CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
+    CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
+
+    switch(stride) {
+        case 2: return combine<IndexHash2>(interleavedArrays, 2);
+        case 3: return combine<IndexHash3>(interleavedArrays, 3);
+    }
+
+    return combine<IndexHash>(interleavedArrays, stride);
+}
+
 }}
@@ -25,8 +25,14 @@
 
 #include "Compile.h"
 
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/MeshView.h"
 #include "Magnum/Math/Vector3.h"
-#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/MeshTools/Batch.h"
+#include "Magnum/MeshTools/Implementation/CompressIndices.h"
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
@@ -37,121 +43,185 @@
 
 namespace Magnum { namespace MeshTools {
 
-std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, const BufferUsage usage) {
-    Mesh mesh;
-    mesh.setPrimitive(meshData.primitive());
+namespace {
+
+template<class T> void prepareIndices(PreparedMesh& prepared, const T& meshData) {
+    prepared.indexCount = 0;
+    prepared.indexType = Mesh::IndexType::UnsignedInt;
+    prepared.indexStart = prepared.indexEnd = 0;
+    if(!meshData.isIndexed()) return;
+
+    const std::vector<UnsignedInt>& indices = meshData.indices();
+    /* Single pass for both the index range and the index type */
+    const auto minmax = std::minmax_element(indices.begin(), indices.end());
+    std::size_t indexCount;
+    std::tie(indexCount, prepared.indexType, prepared.indexData) = Implementation::compressIndices(indices, *minmax.second);
+    prepared.indexCount = indexCount;
+    prepared.indexStart = *minmax.first;
+    prepared.indexEnd = *minmax.second;
+}
 
-    /* Decide about stride and offsets */
-    UnsignedInt stride = sizeof(Shaders::Generic2D::Position::Type);
-    const UnsignedInt normalOffset = sizeof(Shaders::Generic2D::Position::Type);
-    if(meshData.hasTextureCoords2D())
-        stride += sizeof(Shaders::Generic2D::TextureCoordinates::Type);
+}
 
-    /* Create vertex buffer */
-    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::Target::Array}};
+PreparedMesh prepare(const Trade::MeshData2D& meshData) {
+    PreparedMesh prepared;
+    prepared.primitive = meshData.primitive();
+    prepared.dimensions = 2;
+
+    /* Decide about stride and offsets */
+    prepared.stride = sizeof(Shaders::Generic2D::Position::Type);
+    prepared.normalOffset = -1;
+    prepared.textureCoordinatesOffset = -1;
+    if(meshData.hasTextureCoords2D()) {
+        prepared.textureCoordinatesOffset = prepared.stride;
+        prepared.stride += sizeof(Shaders::Generic2D::TextureCoordinates::Type);
+    }
 
     /* Interleave positions */
     std::size_t vertexCount;
-    Containers::Array<char> data;
-    std::tie(vertexCount, std::ignore, data) = MeshTools::interleave(
+    std::tie(vertexCount, std::ignore, prepared.vertexData) = MeshTools::interleave(
         meshData.positions(0),
-        stride - sizeof(Shaders::Generic2D::Position::Type));
-    mesh.addVertexBuffer(*vertexBuffer, 0,
-        Shaders::Generic2D::Position(),
-        stride - sizeof(Shaders::Generic2D::Position::Type));
+        prepared.stride - sizeof(Shaders::Generic2D::Position::Type));
+    prepared.vertexCount = vertexCount;
 
     /* Add also texture coordinates, if present */
-    if(meshData.hasTextureCoords2D()) {
-        MeshTools::interleaveInto(data,
-            normalOffset,
+    if(meshData.hasTextureCoords2D())
+        MeshTools::interleaveInto(prepared.vertexData,
+            prepared.textureCoordinatesOffset,
             meshData.textureCoords2D(0),
-            stride - normalOffset - sizeof(Shaders::Generic2D::TextureCoordinates::Type));
-        mesh.addVertexBuffer(*vertexBuffer, 0,
-            normalOffset,
-            Shaders::Generic2D::TextureCoordinates(),
-            stride - normalOffset - sizeof(Shaders::Generic2D::TextureCoordinates::Type));
-    }
-
-    /* Fill vertex buffer with interleaved data and finalize mesh
-       configuration */
-    vertexBuffer->setData(data, BufferUsage::StaticDraw);
-    mesh.setVertexCount(vertexCount);
-
-    /* Fill index buffer */
-    std::unique_ptr<Buffer> indexBuffer;
-    if(meshData.isIndexed()) {
-        indexBuffer.reset(new Buffer{Buffer::Target::ElementArray});
-        MeshTools::compressIndices(mesh, *indexBuffer, usage, meshData.indices());
-    }
+            prepared.stride - prepared.textureCoordinatesOffset - sizeof(Shaders::Generic2D::TextureCoordinates::Type));
 
-    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
+    prepareIndices(prepared, meshData);
+    return prepared;
 }
 
-std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, const BufferUsage usage) {
-    Mesh mesh;
-    mesh.setPrimitive(meshData.primitive());
+PreparedMesh prepare(const Trade::MeshData3D& meshData) {
+    PreparedMesh prepared;
+    prepared.primitive = meshData.primitive();
+    prepared.dimensions = 3;
 
     /* Decide about stride and offsets */
-    UnsignedInt stride = sizeof(Shaders::Generic3D::Position::Type);
-    const UnsignedInt normalOffset = sizeof(Shaders::Generic3D::Position::Type);
-    UnsignedInt textureCoordsOffset = sizeof(Shaders::Generic3D::Position::Type);
+    prepared.stride = sizeof(Shaders::Generic3D::Position::Type);
+    prepared.normalOffset = -1;
+    prepared.textureCoordinatesOffset = -1;
     if(meshData.hasNormals()) {
-        stride += sizeof(Shaders::Generic3D::Normal::Type);
-        textureCoordsOffset += sizeof(Shaders::Generic3D::Normal::Type);
+        prepared.normalOffset = prepared.stride;
+        prepared.stride += sizeof(Shaders::Generic3D::Normal::Type);
+    }
+    if(meshData.hasTextureCoords2D()) {
+        prepared.textureCoordinatesOffset = prepared.stride;
+        prepared.stride += sizeof(Shaders::Generic3D::TextureCoordinates::Type);
     }
-    if(meshData.hasTextureCoords2D())
-        stride += sizeof(Shaders::Generic3D::TextureCoordinates::Type);
-
-    /* Create vertex buffer */
-    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::Target::Array}};
 
     /* Interleave positions */
     std::size_t vertexCount;
-    Containers::Array<char> data;
-    std::tie(vertexCount, std::ignore, data) = MeshTools::interleave(
+    std::tie(vertexCount, std::ignore, prepared.vertexData) = MeshTools::interleave(
         meshData.positions(0),
-        stride - sizeof(Shaders::Generic3D::Position::Type));
-    mesh.addVertexBuffer(*vertexBuffer, 0,
-        Shaders::Generic3D::Position(),
-        stride - sizeof(Shaders::Generic3D::Position::Type));
+        prepared.stride - sizeof(Shaders::Generic3D::Position::Type));
+    prepared.vertexCount = vertexCount;
 
     /* Add also normals, if present */
-    if(meshData.hasNormals()) {
-        MeshTools::interleaveInto(data,
-            normalOffset,
+    if(meshData.hasNormals())
+        MeshTools::interleaveInto(prepared.vertexData,
+            prepared.normalOffset,
             meshData.normals(0),
-            stride - normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
-        mesh.addVertexBuffer(*vertexBuffer, 0,
-            normalOffset,
-            Shaders::Generic3D::Normal(),
-            stride - normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
-    }
+            prepared.stride - prepared.normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
 
     /* Add also texture coordinates, if present */
-    if(meshData.hasTextureCoords2D()) {
-        MeshTools::interleaveInto(data,
-            textureCoordsOffset,
+    if(meshData.hasTextureCoords2D())
+        MeshTools::interleaveInto(prepared.vertexData,
+            prepared.textureCoordinatesOffset,
             meshData.textureCoords2D(0),
-            stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
+            prepared.stride - prepared.textureCoordinatesOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
+
+    prepareIndices(prepared, meshData);
+    return prepared;
+}
+
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const PreparedMesh& prepared, const BufferUsage usage) {
+    CORRADE_ASSERT(prepared.dimensions == 2 || prepared.dimensions == 3,
+        "MeshTools::compile(): expected 2 or 3 dimensions, got" << prepared.dimensions,
+        std::make_tuple(Mesh{}, std::unique_ptr<Buffer>{}, std::unique_ptr<Buffer>{}));
+
+    Mesh mesh;
+    mesh.setPrimitive(prepared.primitive);
+
+    /* Fill vertex buffer and configure the attributes */
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::Target::Array}};
+    vertexBuffer->setData(prepared.vertexData, usage);
+    if(prepared.dimensions == 2) {
         mesh.addVertexBuffer(*vertexBuffer, 0,
-            textureCoordsOffset,
-            Shaders::Generic3D::TextureCoordinates(),
-            stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
+            Shaders::Generic2D::Position(),
+            prepared.stride - sizeof(Shaders::Generic2D::Position::Type));
+        if(prepared.textureCoordinatesOffset != -1)
+            mesh.addVertexBuffer(*vertexBuffer, 0,
+                prepared.textureCoordinatesOffset,
+                Shaders::Generic2D::TextureCoordinates(),
+                prepared.stride - prepared.textureCoordinatesOffset - sizeof(Shaders::Generic2D::TextureCoordinates::Type));
+    } else {
+        mesh.addVertexBuffer(*vertexBuffer, 0,
+            Shaders::Generic3D::Position(),
+            prepared.stride - sizeof(Shaders::Generic3D::Position::Type));
+        if(prepared.normalOffset != -1)
+            mesh.addVertexBuffer(*vertexBuffer, 0,
+                prepared.normalOffset,
+                Shaders::Generic3D::Normal(),
+                prepared.stride - prepared.normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
+        if(prepared.textureCoordinatesOffset != -1)
+            mesh.addVertexBuffer(*vertexBuffer, 0,
+                prepared.textureCoordinatesOffset,
+                Shaders::Generic3D::TextureCoordinates(),
+                prepared.stride - prepared.textureCoordinatesOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
     }
-
-    /* Fill vertex buffer with interleaved data and finalize mesh
-       configuration */
-    vertexBuffer->setData(data, BufferUsage::StaticDraw);
-    mesh.setVertexCount(vertexCount);
+    mesh.setVertexCount(prepared.vertexCount);
 
     /* Fill index buffer */
     std::unique_ptr<Buffer> indexBuffer;
-    if(meshData.isIndexed()) {
+    if(prepared.indexCount) {
         indexBuffer.reset(new Buffer{Buffer::Target::ElementArray});
-        MeshTools::compressIndices(mesh, *indexBuffer, usage, meshData.indices());
+        indexBuffer->setData(prepared.indexData, usage);
+        mesh.setIndexCount(prepared.indexCount)
+            .setIndexBuffer(*indexBuffer, 0, prepared.indexType, prepared.indexStart, prepared.indexEnd);
     }
 
     return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
 }
 
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, const BufferUsage usage) {
+    return compile(prepare(meshData), usage);
+}
+
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, const BufferUsage usage) {
+    return compile(prepare(meshData), usage);
+}
+
+std::tuple<std::unique_ptr<Mesh>, std::vector<std::unique_ptr<MeshView>>, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const PreparedMesh& prepared, const std::vector<BatchRange>& ranges, const BufferUsage usage) {
+    /* Move the mesh to heap, so the views can reference it */
+    auto compiled = compile(prepared, usage);
+    std::unique_ptr<Mesh> mesh{new Mesh{std::move(std::get<0>(compiled))}};
+
+    std::vector<std::unique_ptr<MeshView>> views;
+    views.reserve(ranges.size());
+    for(const BatchRange& range: ranges) {
+        CORRADE_ASSERT(range.vertexCount || !range.indexCount,
+            "MeshTools::compile(): range with" << range.indexCount << "indices has no vertices", {});
+
+        /* Empty ranges (e.g. from empty meshes passed to batch()) get an
+           empty view, so the views still correspond to the ranges */
+        std::unique_ptr<MeshView> view{new MeshView{*mesh}};
+        if(prepared.indexCount) {
+            if(range.vertexCount)
+                view->setIndexRange(range.indexOffset, range.indexCount, range.vertexOffset, range.vertexOffset + range.vertexCount - 1);
+            else view->setIndexRange(range.indexOffset, 0);
+        } else view->setVertexRange(range.vertexOffset, range.vertexCount);
+        views.push_back(std::move(view));
+    }
+
+    return std::make_tuple(std::move(mesh), std::move(views), std::move(std::get<1>(compiled)), std::move(std::get<2>(compiled)));
+}
+
+std::tuple<std::unique_ptr<Mesh>, std::vector<std::unique_ptr<MeshView>>, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, const std::vector<BatchRange>& ranges, const BufferUsage usage) {
+    return compile(prepare(meshData), ranges, usage);
+}
+
 }}
@@ -26,18 +26,107 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compile()
+ * @brief Struct @ref Magnum::MeshTools::PreparedMesh, function @ref Magnum::MeshTools::prepare(), @ref Magnum::MeshTools::compile()
  */
 
 #include <tuple>
 #include <memory>
+#include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Mesh.h"
 #include "Magnum/Trade/Trade.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
+struct BatchRange;
+
+/**
+@brief Mesh prepared for upload
+
+Self-contained interleaved vertex data, compressed index data and their
+layout, produced by @ref prepare() and uploaded to GPU using
+@ref compile(const PreparedMesh&, BufferUsage).
+*/
+struct PreparedMesh {
+    /** @brief Primitive */
+    MeshPrimitive primitive;
+
+    /**
+     * @brief Dimension count
+     *
+     * Either `2` for data bound to @ref Shaders::Generic2D attributes or `3`
+     * for data bound to @ref Shaders::Generic3D attributes.
+     */
+    UnsignedInt dimensions;
+
+    /** @brief Interleaved vertex data */
+    Containers::Array<char> vertexData;
+
+    Int vertexCount;                /**< @brief Vertex count */
+    UnsignedInt stride;             /**< @brief Vertex stride */
+
+    /**
+     * @brief Offset of normals in the vertex
+     *
+     * `-1` if the mesh doesn't have normals.
+     */
+    Int normalOffset;
+
+    /**
+     * @brief Offset of texture coordinates in the vertex
+     *
+     * `-1` if the mesh doesn't have texture coordinates.
+     */
+    Int textureCoordinatesOffset;
+
+    /** @brief Compressed index data, empty if the mesh is not indexed */
+    Containers::Array<char> indexData;
+
+    Int indexCount;                 /**< @brief Index count */
+    Mesh::IndexType indexType;      /**< @brief Index type */
+    UnsignedInt indexStart;         /**< @brief Minimal index value */
+    UnsignedInt indexEnd;           /**< @brief Maximal index value */
+};
+
+/**
+@brief Prepare 2D mesh data for upload
+
+Does all CPU-side work of @ref compile(const Trade::MeshData2D&, BufferUsage),
+i.e. interleaves the vertex data and compresses the indices. Doesn't do any
+OpenGL calls, so it can be called from any thread, e.g. to prepare many
+meshes in parallel during loading. Upload the result using
+@ref compile(const PreparedMesh&, BufferUsage).
+*/
+MAGNUM_MESHTOOLS_EXPORT PreparedMesh prepare(const Trade::MeshData2D& meshData);
+
+/**
+@brief Prepare 3D mesh data for upload
+
+Does all CPU-side work of @ref compile(const Trade::MeshData3D&, BufferUsage),
+see @ref prepare(const Trade::MeshData2D&) for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT PreparedMesh prepare(const Trade::MeshData3D& meshData);
+
+/**
+@brief Compile prepared mesh data
+
+Creates vertex buffer and possibly also index buffer, if the mesh is indexed,
+uploads the data to them with single @ref Buffer::setData() call each and
+configures the mesh. Positions are bound to @ref Shaders::Generic2D::Position
+or @ref Shaders::Generic3D::Position attribute based on
+@ref PreparedMesh::dimensions, normals to @ref Shaders::Generic3D::Normal and
+texture coordinates to @ref Shaders::Generic2D::TextureCoordinates /
+@ref Shaders::Generic3D::TextureCoordinates. The @p usage parameter is used
+for both vertex and index buffer.
+
+The second returned buffer may be `nullptr` if the mesh is not indexed.
+@see @ref prepare()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const PreparedMesh& prepared, BufferUsage usage);
+
 /**
 @brief Compile 2D mesh data
 
@@ -53,7 +142,8 @@ The second returned buffer may be `nullptr` if the mesh is not indexed.
 
 This is just a convenience function for creating generic meshes, you might want
 to use @ref interleave() and @ref compressIndices() functions instead for
-greater flexibility.
+greater flexibility. Equivalent to calling @ref compile(const PreparedMesh&, BufferUsage)
+on result of @ref prepare(const Trade::MeshData2D&).
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, BufferUsage usage);
 
@@ -72,10 +162,42 @@ The second returned buffer may be `nullptr` if the mesh is not indexed.
 
 This is just a convenience function for creating generic meshes, you might want
 to use @ref interleave() and @ref compressIndices() functions instead for
-greater flexibility.
+greater flexibility. Equivalent to calling @ref compile(const PreparedMesh&, BufferUsage)
+on result of @ref prepare(const Trade::MeshData3D&).
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, BufferUsage usage);
 
+/**
+@brief Compile batched mesh data
+
+Compiles the mesh using @ref compile(const PreparedMesh&, BufferUsage) and
+creates a @ref MeshView for each range, so all batched meshes share the
+same buffers and mesh configuration. The views reference the returned mesh,
+which is thus allocated on heap. Ranges with zero vertex count (e.g. from
+empty meshes passed to @ref batch()) produce empty views. Works for both 2D
+and 3D prepared meshes. Example usage:
+@code
+Trade::MeshData3D data;
+std::vector<MeshTools::BatchRange> ranges;
+std::tie(data, ranges) = MeshTools::batch(meshes);
+
+std::unique_ptr<Mesh> mesh;
+std::vector<std::unique_ptr<MeshView>> views;
+std::unique_ptr<Buffer> vertexBuffer, indexBuffer;
+std::tie(mesh, views, vertexBuffer, indexBuffer) = MeshTools::compile(data, ranges, BufferUsage::StaticDraw);
+@endcode
+@see @ref batch()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::unique_ptr<Mesh>, std::vector<std::unique_ptr<MeshView>>, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const PreparedMesh& prepared, const std::vector<BatchRange>& ranges, BufferUsage usage);
+
+/**
+@brief Compile batched 3D mesh data
+
+Equivalent to calling @ref compile(const PreparedMesh&, const std::vector<BatchRange>&, BufferUsage)
+on result of @ref prepare(const Trade::MeshData3D&).
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::unique_ptr<Mesh>, std::vector<std::unique_ptr<MeshView>>, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, const std::vector<BatchRange>& ranges, BufferUsage usage);
+
 }}
 
 #endif
@@ -31,6 +31,7 @@
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Buffer.h"
+#include "Magnum/MeshTools/Implementation/CompressIndices.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -51,7 +52,11 @@ template<class T> inline std::tuple<std::size_t, Mesh::IndexType, Containers::Ar
     return std::make_tuple(indices.size(), indexType<T>(), std::move(buffer));
 }
 
-std::tuple<std::size_t, Mesh::IndexType, Containers::Array<char>> compressIndicesInternal(const std::vector<UnsignedInt>& indices, UnsignedInt max) {
+}
+
+namespace Implementation {
+
+std::tuple<std::size_t, Mesh::IndexType, Containers::Array<char>> compressIndices(const std::vector<UnsignedInt>& indices, const UnsignedInt max) {
     switch(Math::log(256, max)) {
         case 0:
             return compress<UnsignedByte>(indices);
@@ -69,7 +74,7 @@ std::tuple<std::size_t, Mesh::IndexType, Containers::Array<char>> compressIndice
 }
 
 std::tuple<std::size_t, Mesh::IndexType, Containers::Array<char>> compressIndices(const std::vector<UnsignedInt>& indices) {
-    return compressIndicesInternal(indices, *std::max_element(indices.begin(), indices.end()));
+    return Implementation::compressIndices(indices, *std::max_element(indices.begin(), indices.end()));
 }
 
 void compressIndices(Mesh& mesh, Buffer& buffer, BufferUsage usage, const std::vector<UnsignedInt>& indices) {
@@ -80,7 +85,7 @@ void compressIndices(Mesh& mesh, Buffer& buffer, BufferUsage usage, const std::v
     std::size_t indexCount;
     Mesh::IndexType indexType;
     Containers::Array<char> data;
-    std::tie(indexCount, indexType, data) = compressIndicesInternal(indices, *minmax.second);
+    std::tie(indexCount, indexType, data) = Implementation::compressIndices(indices, *minmax.second);
 
     mesh.setIndexCount(indices.size())
         .setIndexBuffer(buffer, 0, indexType, *minmax.first, *minmax.second);
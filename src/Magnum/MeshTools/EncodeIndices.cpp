@@ -0,0 +1,343 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "EncodeIndices.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace MeshTools {
+
+/*
+    Stream layout:
+
+    - version byte
+    - index count and max index as varints
+    - for each triangle:
+        - 0x00-0xEF: triangle shares edge at position code>>4 in edge FIFO,
+          third vertex is described by lower four bits
+        - 0xF0-0xFF: no shared edge, lower four bits describe first vertex,
+          following byte describes second and third vertex in upper and
+          lower four bits
+      followed by varints for vertices which needed explicit value
+    - vertex description: 0 is next vertex (one past the largest index so
+      far), 1-14 is position in vertex FIFO, 15 means explicit value stored
+      as zigzag-encoded difference from last explicit value
+*/
+
+namespace {
+
+enum: UnsignedByte { Version = 1 };
+
+enum: UnsignedInt {
+    EdgeFifoSize = 16,
+    VertexFifoSize = 16,
+    EdgeLookup = 15,
+    VertexLookup = 14,
+    ExplicitVertex = 15,
+    EdgeMiss = 0xf0
+};
+
+/* Maximal encoded size of one triangle: two code bytes, three varints */
+constexpr std::size_t MaxTriangleSize = 2 + 3*5;
+
+/* Encoder state */
+class Fifo {
+    public:
+        Fifo() {
+            for(std::size_t i = 0; i != EdgeFifoSize; ++i)
+                _edges[i][0] = _edges[i][1] = ~UnsignedInt{};
+            for(std::size_t i = 0; i != VertexFifoSize; ++i)
+                _vertices[i] = ~UnsignedInt{};
+        }
+
+        UnsignedInt findEdge(const UnsignedInt a, const UnsignedInt b) const {
+            for(UnsignedInt i = 0; i != EdgeLookup; ++i) {
+                const UnsignedInt* const edge = _edges[(_edgeOffset - 1 - i) & (EdgeFifoSize - 1)];
+                if(edge[0] == a && edge[1] == b) return i;
+            }
+            return EdgeLookup;
+        }
+
+        void pushEdge(const UnsignedInt a, const UnsignedInt b) {
+            UnsignedInt* const edge = _edges[_edgeOffset & (EdgeFifoSize - 1)];
+            edge[0] = a;
+            edge[1] = b;
+            ++_edgeOffset;
+        }
+
+        /* Returns vertex code, updates the state */
+        UnsignedInt encodeVertex(const UnsignedInt v) {
+            if(v == _next) {
+                pushVertex(v);
+                return 0;
+            }
+
+            for(UnsignedInt i = 0; i != VertexLookup; ++i)
+                if(_vertices[(_vertexOffset - 1 - i) & (VertexFifoSize - 1)] == v) return i + 1;
+
+            pushVertex(v);
+            return ExplicitVertex;
+        }
+
+        void pushVertex(const UnsignedInt v) {
+            _vertices[_vertexOffset & (VertexFifoSize - 1)] = v;
+            ++_vertexOffset;
+            if(v >= _next) _next = v + 1;
+        }
+
+    private:
+        UnsignedInt _edges[EdgeFifoSize][2];
+        UnsignedInt _vertices[VertexFifoSize];
+        UnsignedInt _edgeOffset{}, _vertexOffset{}, _next{};
+};
+
+void writeVarint(std::vector<char>& out, UnsignedInt value) {
+    while(value >= 0x80) {
+        out.push_back(char(value|0x80));
+        value >>= 7;
+    }
+    out.push_back(char(value));
+}
+
+inline UnsignedInt zigzag(const Int value) {
+    return (UnsignedInt(value) << 1)^UnsignedInt(value >> 31);
+}
+
+inline Int unzigzag(const UnsignedInt value) {
+    return Int(value >> 1)^-Int(value & 1);
+}
+
+/* Unchecked read, the caller ensures there's enough data */
+inline UnsignedInt readVarint(const UnsignedByte*& data) {
+    UnsignedInt value = *data & 0x7f;
+    for(UnsignedInt shift = 7; *data++ & 0x80 && shift < 35; shift += 7)
+        value |= UnsignedInt(*data & 0x7f) << shift;
+    return value;
+}
+
+/* Checked read, returns false if out of data */
+bool readVarintChecked(const UnsignedByte*& data, const UnsignedByte* const end, UnsignedInt& value) {
+    value = 0;
+    for(UnsignedInt shift = 0; shift < 35; shift += 7) {
+        if(data == end) return false;
+        const UnsignedByte byte = *data++;
+        value |= UnsignedInt(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+template<class T> bool decode(const UnsignedByte* data, const UnsignedByte* const end, T* const out, const std::size_t triangleCount, const UnsignedInt maxIndex) {
+    /* Decoder state is kept in locals instead of Fifo so the compiler
+       doesn't need to reload it after every write to output */
+    UnsignedInt edges[EdgeFifoSize][2];
+    UnsignedInt vertices[VertexFifoSize];
+    for(std::size_t i = 0; i != EdgeFifoSize; ++i)
+        edges[i][0] = edges[i][1] = ~UnsignedInt{};
+    for(std::size_t i = 0; i != VertexFifoSize; ++i)
+        vertices[i] = ~UnsignedInt{};
+    UnsignedInt edgeOffset = 0, vertexOffset = 0, next = 0, last = 0;
+
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        /* Bound checks only if there isn't enough data for the worst case */
+        const bool checked = std::size_t(end - data) < MaxTriangleSize;
+        if(checked && data == end) return false;
+
+        const UnsignedInt code = *data++;
+        UnsignedInt codes[3];
+        UnsignedInt triangle[3];
+        std::size_t first;
+
+        /* Edge in the FIFO, decode only the third vertex */
+        if(code < EdgeMiss) {
+            const UnsignedInt* const edge = edges[(edgeOffset - 1 - (code >> 4)) & (EdgeFifoSize - 1)];
+            triangle[0] = edge[0];
+            triangle[1] = edge[1];
+            codes[2] = code & 0x0f;
+            first = 2;
+
+        /* All three vertices described separately */
+        } else {
+            if(checked && data == end) return false;
+            codes[0] = code & 0x0f;
+            codes[1] = *data >> 4;
+            codes[2] = *data & 0x0f;
+            ++data;
+            first = 0;
+        }
+
+        for(std::size_t j = first; j != 3; ++j) {
+            UnsignedInt vertex;
+
+            /* Recently used vertex */
+            if(codes[j] - 1 < VertexLookup) {
+                triangle[j] = vertices[(vertexOffset - codes[j]) & (VertexFifoSize - 1)];
+                continue;
+            }
+
+            /* Next vertex */
+            if(codes[j] == 0) vertex = next;
+
+            /* Explicit vertex */
+            else {
+                UnsignedInt delta;
+                if(checked) {
+                    if(!readVarintChecked(data, end, delta)) return false;
+                } else delta = readVarint(data);
+                vertex = last += UnsignedInt(unzigzag(delta));
+            }
+
+            vertices[vertexOffset++ & (VertexFifoSize - 1)] = vertex;
+            if(vertex >= next) next = vertex + 1;
+            triangle[j] = vertex;
+        }
+
+        if(first == 0) {
+            edges[edgeOffset & (EdgeFifoSize - 1)][0] = triangle[1];
+            edges[edgeOffset++ & (EdgeFifoSize - 1)][1] = triangle[0];
+        }
+        edges[edgeOffset & (EdgeFifoSize - 1)][0] = triangle[2];
+        edges[edgeOffset++ & (EdgeFifoSize - 1)][1] = triangle[1];
+        edges[edgeOffset & (EdgeFifoSize - 1)][0] = triangle[0];
+        edges[edgeOffset++ & (EdgeFifoSize - 1)][1] = triangle[2];
+
+        /* Corrupted data could reference uninitialized FIFO entries */
+        if(triangle[0] > maxIndex || triangle[1] > maxIndex || triangle[2] > maxIndex)
+            return false;
+
+        out[i*3 + 0] = T(triangle[0]);
+        out[i*3 + 1] = T(triangle[1]);
+        out[i*3 + 2] = T(triangle[2]);
+    }
+
+    return data == end;
+}
+
+template<class T> Containers::Array<char> decodeInto(const UnsignedByte* const data, const UnsignedByte* const end, const std::size_t indexCount, const UnsignedInt maxIndex) {
+    Containers::Array<char> out(indexCount*sizeof(T));
+    if(!decode<T>(data, end, reinterpret_cast<T*>(out.begin()), indexCount/3, maxIndex)) {
+        Error() << "MeshTools::decodeIndices(): invalid or truncated data";
+        return nullptr;
+    }
+    return out;
+}
+
+}
+
+Containers::Array<char> encodeIndices(const std::vector<UnsignedInt>& indices) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::encodeIndices(): index count is not divisible by 3", nullptr);
+
+    UnsignedInt maxIndex = 0;
+    for(UnsignedInt index: indices) if(index > maxIndex) maxIndex = index;
+
+    std::vector<char> out;
+    out.reserve(16 + indices.size()/2);
+    out.push_back(char(Version));
+    writeVarint(out, UnsignedInt(indices.size()));
+    writeVarint(out, maxIndex);
+
+    Fifo fifo;
+    UnsignedInt last = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        /* Find shared edge in any rotation of the triangle */
+        UnsignedInt triangle[3];
+        UnsignedInt edge = EdgeLookup;
+        for(std::size_t rotation = 0; rotation != 3 && edge == EdgeLookup; ++rotation) {
+            triangle[0] = indices[i + rotation];
+            triangle[1] = indices[i + (rotation + 1) % 3];
+            triangle[2] = indices[i + (rotation + 2) % 3];
+            edge = fifo.findEdge(triangle[0], triangle[1]);
+        }
+
+        /* Explicit vertices are written after the code bytes */
+        UnsignedInt explicitVertices[3];
+        std::size_t explicitCount = 0;
+        auto encodeVertex = [&](const UnsignedInt v) {
+            const UnsignedInt code = fifo.encodeVertex(v);
+            if(code == ExplicitVertex) {
+                explicitVertices[explicitCount++] = zigzag(Int(v - last));
+                last = v;
+            }
+            return code;
+        };
+
+        if(edge != EdgeLookup) {
+            out.push_back(char((edge << 4)|encodeVertex(triangle[2])));
+        } else {
+            triangle[0] = indices[i];
+            triangle[1] = indices[i + 1];
+            triangle[2] = indices[i + 2];
+            const UnsignedInt a = encodeVertex(triangle[0]);
+            const UnsignedInt b = encodeVertex(triangle[1]);
+            const UnsignedInt c = encodeVertex(triangle[2]);
+            out.push_back(char(EdgeMiss|a));
+            out.push_back(char((b << 4)|c));
+            fifo.pushEdge(triangle[1], triangle[0]);
+        }
+
+        fifo.pushEdge(triangle[2], triangle[1]);
+        fifo.pushEdge(triangle[0], triangle[2]);
+
+        for(std::size_t j = 0; j != explicitCount; ++j)
+            writeVarint(out, explicitVertices[j]);
+    }
+
+    Containers::Array<char> data(out.size());
+    std::memcpy(data.begin(), out.data(), out.size());
+    return data;
+}
+
+std::tuple<std::size_t, Mesh::IndexType, Containers::Array<char>> decodeIndices(Containers::ArrayReference<const char> data) {
+    const UnsignedByte* begin = reinterpret_cast<const UnsignedByte*>(data.begin());
+    const UnsignedByte* const end = begin + data.size();
+
+    /* Every triangle takes at least one byte, reject inflated index count
+       before allocating the output for it */
+    UnsignedInt indexCount, maxIndex;
+    if(begin == end || *begin++ != Version || !readVarintChecked(begin, end, indexCount) || !readVarintChecked(begin, end, maxIndex) || indexCount % 3 || indexCount/3 > std::size_t(end - begin)) {
+        Error() << "MeshTools::decodeIndices(): invalid header";
+        return std::make_tuple(0, Mesh::IndexType::UnsignedInt, nullptr);
+    }
+
+    Mesh::IndexType type;
+    Containers::Array<char> out;
+    if(maxIndex <= 0xff) {
+        type = Mesh::IndexType::UnsignedByte;
+        out = decodeInto<UnsignedByte>(begin, end, indexCount, maxIndex);
+    } else if(maxIndex <= 0xffff) {
+        type = Mesh::IndexType::UnsignedShort;
+        out = decodeInto<UnsignedShort>(begin, end, indexCount, maxIndex);
+    } else {
+        type = Mesh::IndexType::UnsignedInt;
+        out = decodeInto<UnsignedInt>(begin, end, indexCount, maxIndex);
+    }
+
+    return std::make_tuple(out ? std::size_t(indexCount) : 0, type, std::move(out));
+}
+
+}}
@@ -0,0 +1,94 @@
+#ifndef Magnum_MeshTools_EncodeIndices_h
+#define Magnum_MeshTools_EncodeIndices_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::encodeIndices(), @ref Magnum::MeshTools::decodeIndices()
+ */
+
+#include <tuple>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Encode triangle indices
+@param indices  Triangle index array
+@return Encoded data
+
+Losslessly compresses the triangle indices into compact byte stream suitable
+for storing on disk or transferring over network. The encoder keeps FIFO of
+recently encoded edges and vertices and each triangle is described by one
+byte if it shares an edge with recent triangle and the remaining vertex is
+either new or recently used, otherwise the vertices are stored as
+variable-length deltas. The best results are thus achieved with meshes
+optimized for vertex cache using @ref tipsify() and with vertices ordered by
+first use.
+
+The triangles might be rotated (e.g. `1 2 0` instead of `0 1 2`), but the
+winding and triangle order is preserved. Use @ref decodeIndices() to decode
+the data. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+MeshTools::tipsify(indices, vertexCount, 24);
+Containers::Array<char> encoded = MeshTools::encodeIndices(indices);
+@endcode
+
+@attention Index count must be divisible by 3.
+*/
+Containers::Array<char> MAGNUM_MESHTOOLS_EXPORT encodeIndices(const std::vector<UnsignedInt>& indices);
+
+/**
+@brief Decode triangle indices
+@param data     Data encoded with @ref encodeIndices()
+@return Index count, type and index array
+
+Decodes the indices directly into smallest possible type, similarly to
+@ref compressIndices(), so the result can be uploaded to index buffer without
+any additional processing:
+@code
+std::size_t indexCount;
+Mesh::IndexType indexType;
+Containers::Array<char> data;
+std::tie(indexCount, indexType, data) = MeshTools::decodeIndices(encoded);
+
+indexBuffer.setData(data, BufferUsage::StaticDraw);
+mesh.setIndexCount(indexCount)
+    .setIndexBuffer(indexBuffer, 0, indexType);
+@endcode
+
+@attention If the data are truncated or not produced by @ref encodeIndices(),
+    the function prints message to error output and returns empty array.
+*/
+std::tuple<std::size_t, Mesh::IndexType, Containers::Array<char>> MAGNUM_MESHTOOLS_EXPORT decodeIndices(Containers::ArrayReference<const char> data);
+
+}}
+
+#endif
@@ -58,6 +58,7 @@ use the same indices.
 
 @attention Index count must be divisible by 3, otherwise zero length result
     is generated.
+@see @ref generateSmoothNormals()
 */
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
 
@@ -0,0 +1,96 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateSmoothNormals.h"
+
+#include <cmath>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+
+Float angle(const Vector3& a, const Vector3& b) {
+    const Float lengths = std::sqrt(a.dot()*b.dot());
+    if(lengths == 0.0f) return 0.0f;
+    return std::acos(Math::clamp(Vector3::dot(a, b)/lengths, -1.0f, 1.0f));
+}
+
+void smoothNormalContributions(const Vector3& a, const Vector3& b, const Vector3& c, const NormalWeighting weighting, Vector3(&out)[3]) {
+    const Vector3 ab = b - a;
+    const Vector3 bc = c - b;
+    const Vector3 ca = a - c;
+
+    /* Length of the cross product is twice the face area */
+    const Vector3 cross = Vector3::cross(ab, -ca);
+    if(weighting == NormalWeighting::Area) {
+        out[0] = out[1] = out[2] = cross;
+        return;
+    }
+
+    /* Degenerate faces don't have any direction */
+    const Float length = cross.length();
+    if(length == 0.0f) {
+        out[0] = out[1] = out[2] = Vector3{};
+        return;
+    }
+
+    const Vector3 normal = cross/length;
+    out[0] = normal*angle(ab, -ca);
+    out[1] = normal*angle(bc, -ab);
+    out[2] = normal*angle(ca, -bc);
+}
+
+}
+
+std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const NormalWeighting weighting) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3", {});
+
+    /* Accumulate weighted face normals directly into the vertices */
+    std::vector<Vector3> normals(positions.size());
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        CORRADE_ASSERT(a < positions.size() && b < positions.size() && c < positions.size(),
+            "MeshTools::generateSmoothNormals(): index out of range", {});
+
+        Vector3 contributions[3];
+        Implementation::smoothNormalContributions(positions[a], positions[b], positions[c], weighting, contributions);
+        normals[a] += contributions[0];
+        normals[b] += contributions[1];
+        normals[c] += contributions[2];
+    }
+
+    /* Normalize, leave zero normals of unreferenced vertices as they are */
+    for(Vector3& normal: normals) {
+        const Float length = normal.length();
+        if(length != 0.0f) normal /= length;
+    }
+
+    return normals;
+}
+
+}}
@@ -0,0 +1,101 @@
+#ifndef Magnum_MeshTools_GenerateSmoothNormals_h
+#define Magnum_MeshTools_GenerateSmoothNormals_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::MeshTools::NormalWeighting, function @ref Magnum::MeshTools::generateSmoothNormals()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Face normal weighting
+
+@see @ref generateSmoothNormals()
+*/
+enum class NormalWeighting: UnsignedByte {
+    /**
+     * Face normals are weighted by face area, large faces have more
+     * influence than small ones. Cheapest to calculate, but the result
+     * depends on how the surface is tessellated.
+     */
+    Area,
+
+    /**
+     * Face normals are weighted by the angle the face has at given vertex.
+     * The result doesn't depend on tessellation of the surface, e.g. corner
+     * of a cube has normal pointing exactly along the diagonal regardless of
+     * how the faces are split into triangles.
+     */
+    Angle
+};
+
+namespace Implementation {
+    /* Angle between two edges going from the same vertex, zero if any of
+       them has zero length, shared with generateTangents() */
+    MAGNUM_MESHTOOLS_EXPORT Float angle(const Vector3& a, const Vector3& b);
+
+    /* Weighted face normal contributions for each face vertex, shared with
+       the streaming variant */
+    MAGNUM_MESHTOOLS_EXPORT void smoothNormalContributions(const Vector3& a, const Vector3& b, const Vector3& c, NormalWeighting weighting, Vector3(&out)[3]);
+}
+
+/**
+@brief Generate smooth normals
+@param indices      Array of triangle face indexes
+@param positions    Array of vertex positions
+@param weighting    Face normal weighting
+@return Normal for each position
+
+For each vertex computes weighted average of normals of all faces sharing
+that vertex (assuming counterclockwise winding). Only faces referencing the
+same index are averaged, vertices with the same position but different index
+(e.g. along texture seams or hard edges) have their own normal. As the normals
+correspond one-to-one to positions, they can be indexed with the same
+@p indices and no @ref removeDuplicates() or @ref combineIndexedArrays() pass
+is needed. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions);
+@endcode
+
+Vertices not referenced by any non-degenerate face get zero normal.
+@attention Index count must be divisible by 3 and all indices must be in
+    range of @p positions.
+@see @ref generateFlatNormals(), @ref generateTangents()
+*/
+std::vector<Vector3> MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, NormalWeighting weighting = NormalWeighting::Angle);
+
+}}
+
+#endif
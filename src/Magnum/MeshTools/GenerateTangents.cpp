@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateTangents.h"
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Tangent projected onto plane given by the normal */
+inline Vector3 orthogonalize(const Vector3& tangent, const Vector3& normal) {
+    const Vector3 projected = tangent - normal*Vector3::dot(normal, tangent);
+    const Float length = projected.length();
+    return length == 0.0f ? Vector3{} : projected/length;
+}
+
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector4>> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateTangents(): index count is not divisible by 3",
+        (std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector4>>()));
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoordinates.size() == positions.size(), "MeshTools::generateTangents(): attribute arrays don't have the same size",
+        (std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector4>>()));
+
+    /* Vertices keep their index for handedness of the first face using them,
+       faces with the other handedness get a new vertex at the end */
+    constexpr UnsignedInt NoVertex = ~UnsignedInt{};
+    std::vector<UnsignedInt> outIndices(indices.size());
+    std::vector<UnsignedInt> mapping(positions.size());
+    for(std::size_t i = 0; i != mapping.size(); ++i) mapping[i] = i;
+    std::vector<Float> handedness(positions.size(), 0.0f);
+    std::vector<UnsignedInt> split(positions.size(), NoVertex);
+    std::vector<Vector3> tangentSums(positions.size());
+
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt face[]{indices[i], indices[i + 1], indices[i + 2]};
+        CORRADE_ASSERT(face[0] < positions.size() && face[1] < positions.size() && face[2] < positions.size(), "MeshTools::generateTangents(): index out of range",
+            (std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector4>>()));
+
+        /* Face tangent and bitangent from texture coordinate derivatives */
+        const Vector3 e1 = positions[face[1]] - positions[face[0]];
+        const Vector3 e2 = positions[face[2]] - positions[face[0]];
+        const Vector2 uv1 = textureCoordinates[face[1]] - textureCoordinates[face[0]];
+        const Vector2 uv2 = textureCoordinates[face[2]] - textureCoordinates[face[0]];
+        const Float determinant = uv1.x()*uv2.y() - uv2.x()*uv1.y();
+        Vector3 tangent, bitangent;
+        if(determinant != 0.0f) {
+            tangent = (e1*uv2.y() - e2*uv1.y())/determinant;
+            bitangent = (e2*uv1.x() - e1*uv2.x())/determinant;
+        }
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt vertex = face[j];
+            const Vector3& normal = normals[vertex];
+
+            /* Corner handedness, degenerate mapping is taken as right-handed */
+            const Float w = Vector3::dot(Vector3::cross(normal, tangent), bitangent) < 0.0f ? -1.0f : 1.0f;
+
+            /* Pick the output vertex, split if the handedness differs */
+            UnsignedInt outVertex = vertex;
+            if(handedness[vertex] == 0.0f) handedness[vertex] = w;
+            else if(handedness[vertex] != w) {
+                if(split[vertex] == NoVertex) {
+                    split[vertex] = mapping.size();
+                    mapping.push_back(vertex);
+                    handedness.push_back(w);
+                    tangentSums.emplace_back();
+                }
+                outVertex = split[vertex];
+            }
+            outIndices[i + j] = outVertex;
+
+            /* Accumulate angle-weighted tangent projected to vertex normal */
+            const Vector3& position = positions[vertex];
+            const Vector3 previous = positions[face[(j + 2) % 3]] - position;
+            const Vector3 next = positions[face[(j + 1) % 3]] - position;
+            tangentSums[outVertex] += orthogonalize(tangent, normal)*Implementation::angle(next, previous);
+        }
+    }
+
+    /* Orthonormalize the sums */
+    std::vector<Vector4> tangents;
+    tangents.reserve(mapping.size());
+    for(std::size_t i = 0; i != mapping.size(); ++i)
+        tangents.emplace_back(orthogonalize(tangentSums[i], normals[mapping[i]]),
+            handedness[i] == 0.0f ? 1.0f : handedness[i]);
+
+    return std::make_tuple(std::move(outIndices), std::move(mapping), std::move(tangents));
+}
+
+}}
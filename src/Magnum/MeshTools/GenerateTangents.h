@@ -0,0 +1,85 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate tangents
+@param indices              Array of triangle face indexes
+@param positions            Array of vertex positions
+@param normals              Array of normalized vertex normals
+@param textureCoordinates   Array of texture coordinates
+@return New index array, vertex mapping and tangents
+
+Computes per-vertex tangent space for normal mapping, following the
+conventions of MikkTSpace: face tangents are derived from texture coordinate
+derivatives, orthogonalized against vertex normal and averaged using the
+angle each face has at given vertex. The returned tangent has handedness in
+its @ref Vector4::w() "W" component, bitangent is then calculated in the
+shader as `cross(normal, tangent.xyz)*tangent.w`.
+
+Vertices where faces with mirrored texture mapping meet (i.e. faces with
+different handedness) are split, other vertices keep their original index.
+The returned vertex mapping contains original index for each output vertex,
+use it with @ref duplicate() to expand the other vertex attributes:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+std::vector<Vector2> textureCoordinates;
+
+std::vector<UnsignedInt> mapping;
+std::vector<Vector4> tangents;
+std::tie(indices, mapping, tangents) = MeshTools::generateTangents(indices,
+    positions, normals, textureCoordinates);
+positions = MeshTools::duplicate(mapping, positions);
+normals = MeshTools::duplicate(mapping, normals);
+textureCoordinates = MeshTools::duplicate(mapping, textureCoordinates);
+@endcode
+
+First `positions.size()` items of the mapping are identity, the split
+vertices are appended at the end. Vertices not referenced by any face get
+zero tangent.
+@attention Index count must be divisible by 3 and all attribute arrays must
+    have the same size, otherwise zero length result is generated.
+@see @ref generateSmoothNormals()
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector4>> MAGNUM_MESHTOOLS_EXPORT generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates);
+
+}}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Interleave.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Fixed-size copy, compiled to plain loads and stores */
+template<std::size_t size> void copyStrided(char* destination, const std::size_t destinationStride, const char* source, const std::size_t sourceStride, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i, destination += destinationStride, source += sourceStride)
+        std::memcpy(destination, source, size);
+}
+
+void copyStrided(char* const destination, const std::size_t destinationStride, const char* const source, const std::size_t sourceStride, const std::size_t size, const std::size_t count) {
+    /* Both sides contiguous, copy everything at once */
+    if(destinationStride == size && sourceStride == size) {
+        std::memcpy(destination, source, size*count);
+        return;
+    }
+
+    switch(size) {
+        case 4: return copyStrided<4>(destination, destinationStride, source, sourceStride, count);
+        case 8: return copyStrided<8>(destination, destinationStride, source, sourceStride, count);
+        case 12: return copyStrided<12>(destination, destinationStride, source, sourceStride, count);
+        case 16: return copyStrided<16>(destination, destinationStride, source, sourceStride, count);
+    }
+
+    char* d = destination;
+    const char* s = source;
+    for(std::size_t i = 0; i != count; ++i, d += destinationStride, s += sourceStride)
+        std::memcpy(d, s, size);
+}
+
+}
+
+void interleaveStridedInto(Containers::ArrayReference<char> buffer, const std::size_t stride, const std::size_t count, const std::vector<InterleaveAttribute>& attributes) {
+    CORRADE_ASSERT(count*stride <= buffer.size(), "MeshTools::interleaveStridedInto(): the data buffer is too small, expected" << count*stride << "but got" << buffer.size(), );
+
+    for(const InterleaveAttribute& attribute: attributes) {
+        CORRADE_ASSERT(attribute.offset + attribute.size <= stride, "MeshTools::interleaveStridedInto(): attribute with offset" << attribute.offset << "and size" << attribute.size << "doesn't fit into stride" << stride, );
+        copyStrided(buffer.begin() + attribute.offset, stride, static_cast<const char*>(attribute.data), attribute.stride, attribute.size, count);
+    }
+}
+
+void deinterleaveStrided(Containers::ArrayReference<const char> buffer, const std::size_t stride, const std::size_t count, const std::vector<DeinterleaveAttribute>& attributes) {
+    CORRADE_ASSERT(count*stride <= buffer.size(), "MeshTools::deinterleaveStrided(): the data buffer is too small, expected" << count*stride << "but got" << buffer.size(), );
+
+    for(const DeinterleaveAttribute& attribute: attributes) {
+        CORRADE_ASSERT(attribute.offset + attribute.size <= stride, "MeshTools::deinterleaveStrided(): attribute with offset" << attribute.offset << "and size" << attribute.size << "doesn't fit into stride" << stride, );
+        copyStrided(static_cast<char*>(attribute.data), attribute.stride, buffer.begin() + attribute.offset, stride, attribute.size, count);
+    }
+}
+
+}}
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::interleave(), @ref Magnum::MeshTools::interleaveInto()
+ * @brief Function @ref Magnum::MeshTools::interleave(), @ref Magnum::MeshTools::interleaveInto(), @ref Magnum::MeshTools::interleaveStridedInto(), @ref Magnum::MeshTools::deinterleaveStrided(), struct @ref Magnum::MeshTools::InterleaveAttribute, @ref Magnum::MeshTools::DeinterleaveAttribute
  */
 
 #include <cstring>
@@ -36,6 +36,7 @@
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Buffer.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -218,6 +219,75 @@ template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::
     buffer.setData(attribute, usage);
 }
 
+/**
+@brief Attribute description for @ref interleaveStridedInto()
+
+@see @ref DeinterleaveAttribute
+*/
+struct InterleaveAttribute {
+    const void* data;       /**< @brief Pointer to first element */
+    std::size_t size;       /**< @brief Element size in bytes */
+    std::size_t stride;     /**< @brief Distance between elements in the source data */
+    std::size_t offset;     /**< @brief Offset of the attribute in interleaved data */
+};
+
+/**
+@brief Attribute description for @ref deinterleaveStrided()
+
+@see @ref InterleaveAttribute
+*/
+struct DeinterleaveAttribute {
+    void* data;             /**< @brief Pointer to first element */
+    std::size_t size;       /**< @brief Element size in bytes */
+    std::size_t stride;     /**< @brief Distance between elements in the destination data */
+    std::size_t offset;     /**< @brief Offset of the attribute in interleaved data */
+};
+
+/**
+@brief %Interleave vertex attributes described at runtime into existing buffer
+@param buffer       Output buffer
+@param stride       Stride of interleaved data
+@param count        Attribute count
+@param attributes   Attribute descriptions
+
+Unlike @ref interleave() and @ref interleaveInto() the layout doesn't need to
+be known at compile time. The source data can be strided (e.g. already
+interleaved with other attributes) and the @p buffer can be any memory,
+including mapped buffer. Gaps between the attributes are left untouched.
+Copying of elements with size of 4, 8, 12 and 16 bytes is specialized.
+Example usage, interleaving positions with every other item in a texture
+coordinate array:
+@code
+std::vector<Vector3> positions;
+std::vector<Vector2> textureCoordinates;
+Containers::Array<char> data{positions.size()*20};
+MeshTools::interleaveStridedInto(data, 20, positions.size(), {
+    {positions.data(), sizeof(Vector3), sizeof(Vector3), 0},
+    {textureCoordinates.data(), sizeof(Vector2), 2*sizeof(Vector2), sizeof(Vector3)}
+});
+@endcode
+
+@attention The @p buffer must be large enough to contain @p count items with
+    given @p stride and all attributes must fit into the stride.
+@see @ref deinterleaveStrided()
+*/
+void MAGNUM_MESHTOOLS_EXPORT interleaveStridedInto(Containers::ArrayReference<char> buffer, std::size_t stride, std::size_t count, const std::vector<InterleaveAttribute>& attributes);
+
+/**
+@brief Deinterleave vertex attributes described at runtime
+@param buffer       Interleaved data
+@param stride       Stride of interleaved data
+@param count        Attribute count
+@param attributes   Attribute descriptions
+
+Inverse operation to @ref interleaveStridedInto(), copies attributes from
+interleaved @p buffer to (possibly strided) destination memory.
+
+@attention The @p buffer must be large enough to contain @p count items with
+    given @p stride and all attributes must fit into the stride.
+*/
+void MAGNUM_MESHTOOLS_EXPORT deinterleaveStrided(Containers::ArrayReference<const char> buffer, std::size_t stride, std::size_t count, const std::vector<DeinterleaveAttribute>& attributes);
+
 }}
 
 #endif
@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeOverdraw.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<UnsignedInt>& clusters, const std::vector<Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::optimizeOverdraw(): index count is not divisible by 3!", );
+    CORRADE_ASSERT(indices.empty() || (!clusters.empty() && clusters.front() == 0), "MeshTools::optimizeOverdraw(): first cluster doesn't start at 0", );
+    if(indices.empty()) return;
+
+    /* Simulate FIFO post-transform cache the same way as tipsify() does,
+       vertex is in the cache if less than cacheSize misses happened since it
+       was last loaded */
+    std::vector<UnsignedInt> timestamp(positions.size());
+    UnsignedInt time = cacheSize+1;
+
+    /* Count cache misses of the whole mesh */
+    std::size_t misses = 0;
+    for(const UnsignedInt index: indices) {
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::optimizeOverdraw(): index out of range", );
+        if(time-timestamp[index] > cacheSize) {
+            timestamp[index] = time++;
+            ++misses;
+        }
+    }
+    const Float acmr = Float(misses)/(indices.size()/3);
+
+    /* Split the clusters further at places where cache miss ratio of the
+       cluster rendered in isolation is good enough */
+    std::vector<UnsignedInt> splitClusters;
+    splitClusters.reserve(clusters.size());
+    for(std::size_t c = 0; c != clusters.size(); ++c) {
+        const UnsignedInt end = c + 1 == clusters.size() ? indices.size() : clusters[c+1];
+        CORRADE_ASSERT(clusters[c] < end && !(clusters[c]%3) && end <= indices.size(), "MeshTools::optimizeOverdraw(): invalid cluster offset" << clusters[c], );
+
+        splitClusters.push_back(clusters[c]);
+
+        /* Flush the cache, the cluster can be rendered after any other */
+        time += cacheSize+1;
+        std::size_t clusterMisses = 0, clusterTriangles = 0;
+        for(UnsignedInt i = clusters[c]; i != end; i += 3) {
+            for(UnsignedInt j = 0; j != 3; ++j) {
+                const UnsignedInt index = indices[i+j];
+                if(time-timestamp[index] > cacheSize) {
+                    timestamp[index] = time++;
+                    ++clusterMisses;
+                }
+            }
+
+            /* Start new cluster if this one is good enough and isn't at the
+               end already */
+            if(clusterMisses < threshold*acmr*(++clusterTriangles) && i+3 != end) {
+                splitClusters.push_back(i+3);
+                time += cacheSize+1;
+                clusterMisses = clusterTriangles = 0;
+            }
+        }
+    }
+
+    /* Area-weighted centroid and normal of each cluster and of whole mesh */
+    std::vector<Vector3> clusterCentroids(splitClusters.size());
+    std::vector<Vector3> clusterNormals(splitClusters.size());
+    Vector3 meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t cluster = 0; cluster != splitClusters.size(); ++cluster) {
+        const UnsignedInt end = cluster + 1 == splitClusters.size() ? indices.size() : splitClusters[cluster+1];
+
+        Float clusterArea = 0.0f;
+        for(UnsignedInt i = splitClusters[cluster]; i != end; i += 3) {
+            const Vector3& a = positions[indices[i]];
+            const Vector3& b = positions[indices[i+1]];
+            const Vector3& c = positions[indices[i+2]];
+
+            /* Length of the cross product is twice the triangle area */
+            const Vector3 normal = Vector3::cross(b - a, c - a);
+            const Float area = normal.length();
+            clusterCentroids[cluster] += (a + b + c)*area;
+            clusterNormals[cluster] += normal;
+            clusterArea += area;
+        }
+
+        meshCentroid += clusterCentroids[cluster];
+        meshArea += clusterArea;
+        if(clusterArea != 0.0f) clusterCentroids[cluster] /= clusterArea*3.0f;
+    }
+    if(meshArea != 0.0f) meshCentroid /= meshArea*3.0f;
+
+    /* Occlusion potential of each cluster -- clusters facing away from mesh
+       center are more likely to occlude other parts of the mesh */
+    std::vector<Float> occlusionPotential(splitClusters.size());
+    for(std::size_t c = 0; c != splitClusters.size(); ++c) {
+        const Float normalLength = clusterNormals[c].length();
+        if(normalLength != 0.0f)
+            occlusionPotential[c] = Vector3::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c])/normalLength;
+    }
+
+    /* Sort the clusters by decreasing occlusion potential, keeping the
+       original order for clusters with the same potential */
+    std::vector<UnsignedInt> order(splitClusters.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&occlusionPotential](UnsignedInt a, UnsignedInt b) {
+        return occlusionPotential[a] > occlusionPotential[b];
+    });
+
+    /* Write the clusters in new order */
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    for(const UnsignedInt c: order) {
+        const UnsignedInt end = c + 1 == splitClusters.size() ? indices.size() : splitClusters[c+1];
+        outputIndices.insert(outputIndices.end(), indices.begin() + splitClusters[c], indices.begin() + end);
+    }
+
+    /* Swap original index buffer with optimized */
+    std::swap(indices, outputIndices);
+}
+
+}}
@@ -0,0 +1,73 @@
+#ifndef Magnum_MeshTools_OptimizeOverdraw_h
+#define Magnum_MeshTools_OptimizeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeOverdraw()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Reorder triangle clusters to reduce overdraw
+@param[in,out] indices  Index array to operate on
+@param[in] clusters     Cluster offsets, as produced by
+    @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t, std::vector<UnsignedInt>&)
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    Maximal allowed degradation of average cache miss
+    ratio
+
+Second step of the algorithm described in @ref tipsify(). The clusters are
+first subdivided further at places where the average cache miss ratio (ACMR)
+of the cluster rendered in isolation drops below @p threshold times ACMR of
+the whole mesh, then they are sorted by view-independent occlusion potential,
+so clusters which are likely to occlude other parts of the mesh are rendered
+first. Value of `1.0f` for @p threshold keeps the vertex cache efficiency
+nearly intact, larger values produce more smaller clusters, resulting in less
+overdraw at the cost of more cache misses. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> clusters;
+MeshTools::tipsify(indices, positions.size(), 24, clusters);
+MeshTools::optimizeOverdraw(indices, clusters, positions, 24, 1.05f);
+@endcode
+
+@attention Index count must be divisible by 3 and the cluster offsets must be
+    sorted, start with `0` and point to triangle boundaries.
+*/
+void MAGNUM_MESHTOOLS_EXPORT optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<UnsignedInt>& clusters, const std::vector<Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+}}
+
+#endif
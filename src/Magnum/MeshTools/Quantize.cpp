@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <cstring>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::tuple<std::vector<Math::Vector3<UnsignedShort>>, Matrix4, Float> quantizePositions(const std::vector<Vector3>& positions) {
+    if(positions.empty()) return std::make_tuple(std::vector<Math::Vector3<UnsignedShort>>{}, Matrix4{}, 0.0f);
+
+    /* Bounding box, uniform scale so the normals aren't affected */
+    Vector3 min = positions[0], max = positions[0];
+    for(const Vector3& position: positions) {
+        min = Math::min(min, position);
+        max = Math::max(max, position);
+    }
+    Float scale = (max - min).max();
+    if(scale == 0.0f) scale = 1.0f;
+
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    quantized.reserve(positions.size());
+    Float error = 0.0f;
+    for(const Vector3& position: positions) {
+        const Vector3 normalized = Math::clamp((position - min)/scale, 0.0f, 1.0f)*Float(std::numeric_limits<UnsignedShort>::max());
+        const Math::Vector3<UnsignedShort> value{
+            UnsignedShort(std::round(normalized.x())),
+            UnsignedShort(std::round(normalized.y())),
+            UnsignedShort(std::round(normalized.z()))};
+        quantized.push_back(value);
+
+        error = Math::max(error, (Math::normalize<Vector3>(value)*scale + min - position).length());
+    }
+
+    return std::make_tuple(std::move(quantized), Matrix4::translation(min)*Matrix4::scaling(Vector3(scale)), error);
+}
+
+Vector3 decodeNormalOctahedral(const Vector2& encoded) {
+    Vector3 normal{encoded, 1.0f - std::abs(encoded.x()) - std::abs(encoded.y())};
+    if(normal.z() < 0.0f) {
+        const Vector2 folded{
+            (1.0f - std::abs(normal.y()))*(normal.x() >= 0.0f ? 1.0f : -1.0f),
+            (1.0f - std::abs(normal.x()))*(normal.y() >= 0.0f ? 1.0f : -1.0f)};
+        normal.xy() = folded;
+    }
+    return normal.normalized();
+}
+
+std::pair<std::vector<UnsignedInt>, Float> quantizeNormalsPacked(const std::vector<Vector3>& normals) {
+    std::vector<UnsignedInt> packed;
+    packed.reserve(normals.size());
+    Float error = 0.0f;
+    for(const Vector3& normal: normals) {
+        const Vector3 normalized = Math::clamp(normal, -1.0f, 1.0f)*511.0f;
+        const Vector3i value{Int(std::round(normalized.x())),
+                             Int(std::round(normalized.y())),
+                             Int(std::round(normalized.z()))};
+
+        /* X in lowest bits, two's complement in each component, W is zero */
+        packed.push_back((UnsignedInt(value.x()) & 0x3ff)|
+                        ((UnsignedInt(value.y()) & 0x3ff) << 10)|
+                        ((UnsignedInt(value.z()) & 0x3ff) << 20));
+
+        const Float cosine = Vector3::dot((Vector3(value)/511.0f).normalized(), normal.normalized());
+        error = Math::max(error, std::acos(Math::clamp(cosine, -1.0f, 1.0f)));
+    }
+
+    return {std::move(packed), error};
+}
+
+std::pair<std::vector<Math::Vector2<UnsignedShort>>, Float> quantizeTextureCoordinates(const std::vector<Vector2>& textureCoordinates) {
+    std::vector<Math::Vector2<UnsignedShort>> quantized;
+    quantized.reserve(textureCoordinates.size());
+    Float error = 0.0f;
+    for(const Vector2& textureCoordinate: textureCoordinates) {
+        const Math::Vector2<UnsignedShort> value{packHalf(textureCoordinate.x()),
+                                                 packHalf(textureCoordinate.y())};
+        quantized.push_back(value);
+
+        error = Math::max({error,
+            std::abs(unpackHalf(value.x()) - textureCoordinate.x()),
+            std::abs(unpackHalf(value.y()) - textureCoordinate.y())});
+    }
+
+    return {std::move(quantized), error};
+}
+
+UnsignedShort packHalf(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+
+    const UnsignedInt sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    UnsignedShort out;
+
+    /* Too large for half or NaN, NaN stays NaN */
+    if(bits >= 0x47800000u)
+        out = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+
+    /* Zero or denormal in half, let the FPU do the rounding by adding a
+       value with exponent such that the mantissa is aligned to half
+       denormals */
+    else if(bits < 0x38800000u) {
+        constexpr UnsignedInt magicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+        Float magic, shifted;
+        std::memcpy(&magic, &magicBits, 4);
+        std::memcpy(&shifted, &bits, 4);
+        shifted += magic;
+        std::memcpy(&bits, &shifted, 4);
+        out = bits - magicBits;
+
+    /* Normalized, rebias the exponent and round to nearest even */
+    } else {
+        const UnsignedInt mantissaOdd = (bits >> 13) & 1;
+        bits += (UnsignedInt(15 - 127) << 23) + 0xfff;
+        bits += mantissaOdd;
+        out = bits >> 13;
+    }
+
+    return out | (sign >> 16);
+}
+
+Float unpackHalf(const UnsignedShort value) {
+    constexpr UnsignedInt shiftedExponent = 0x7c00 << 13;
+
+    UnsignedInt bits = (value & 0x7fff) << 13;
+    const UnsignedInt exponent = shiftedExponent & bits;
+    bits += (127 - 15) << 23;
+
+    Float out;
+
+    /* Infinity or NaN, extra exponent adjustment */
+    if(exponent == shiftedExponent) {
+        bits += (128 - 16) << 23;
+        std::memcpy(&out, &bits, 4);
+
+    /* Zero or denormal, renormalize */
+    } else if(exponent == 0) {
+        constexpr UnsignedInt magicBits = 113 << 23;
+        Float magic;
+        std::memcpy(&magic, &magicBits, 4);
+        bits += 1 << 23;
+        std::memcpy(&out, &bits, 4);
+        out -= magic;
+
+    } else std::memcpy(&out, &bits, 4);
+
+    return (value & 0x8000) ? -out : out;
+}
+
+}}
@@ -0,0 +1,196 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantizePositions(), @ref Magnum::MeshTools::quantizeNormalsOctahedral(), @ref Magnum::MeshTools::decodeNormalOctahedral(), @ref Magnum::MeshTools::quantizeNormalsPacked(), @ref Magnum::MeshTools::quantizeTextureCoordinates(), @ref Magnum::MeshTools::packHalf(), @ref Magnum::MeshTools::unpackHalf()
+ */
+
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantize positions to 16-bit normalized integers
+@param positions    Vertex positions
+@return Quantized positions, dequantization transformation and maximal
+    distance between original and dequantized position
+
+The positions are mapped into the bounding box of the mesh and stored as
+unsigned normalized 16-bit integers, halving the memory compared to
+@ref Vector3. The scaling is uniform, so the normal matrix calculated from
+the transformation isn't affected. To render the mesh, configure the
+attribute as normalized unsigned short and multiply the transformation matrix
+with the returned dequantization transformation:
+@code
+std::vector<Math::Vector3<UnsignedShort>> quantized;
+Matrix4 dequantization;
+Float error;
+std::tie(quantized, dequantization, error) = MeshTools::quantizePositions(positions);
+
+mesh.addVertexBuffer(buffer, 0, Shaders::Generic3D::Position{
+    Shaders::Generic3D::Position::DataType::UnsignedShort,
+    Shaders::Generic3D::Position::DataOption::Normalized});
+
+shader.setTransformationMatrix(transformation*dequantization);
+@endcode
+
+@attention Some drivers prefer attributes aligned to four bytes, consider
+    adding two-byte gap after each position with @ref interleave().
+*/
+std::tuple<std::vector<Math::Vector3<UnsignedShort>>, Matrix4, Float> MAGNUM_MESHTOOLS_EXPORT quantizePositions(const std::vector<Vector3>& positions);
+
+/**
+@brief Quantize normals using octahedral encoding
+@tparam T           Either @ref Magnum::Byte "Byte" or @ref Magnum::Short "Short"
+@param normals      Normalized vertex normals
+@return Encoded normals and maximal angle in radians between original and
+    decoded normal
+
+Projects the normals onto octahedron, unfolds it into square and stores the
+result as two signed normalized integers. Compared to @ref Vector3 the
+normals occupy just two or four bytes and the error is distributed more
+evenly than with @ref quantizeNormalsPacked(). The data are meant to be
+configured as two-component normalized signed attribute:
+@code
+mesh.addVertexBuffer(buffer, 0, Shaders::Generic3D::Normal{
+    Shaders::Generic3D::Normal::Components::Two,
+    Shaders::Generic3D::Normal::DataType::Byte,
+    Shaders::Generic3D::Normal::DataOption::Normalized});
+@endcode
+
+The shader then needs to decode the normal, equivalently to
+@ref decodeNormalOctahedral():
+@code
+vec3 normal = vec3(encoded.xy, 1.0 - abs(encoded.x) - abs(encoded.y));
+if(normal.z < 0.0) normal.xy = (1.0 - abs(normal.yx))*sign(normal.xy);
+normal = normalize(normal);
+@endcode
+*/
+template<class T> std::pair<std::vector<Math::Vector2<T>>, Float> quantizeNormalsOctahedral(const std::vector<Vector3>& normals);
+
+/**
+@brief Decode octahedral-encoded normal
+
+Inverse to the encoding done in @ref quantizeNormalsOctahedral(), expects the
+value already normalized to range @f$ [-1, 1] @f$, e.g. using
+@ref Math::normalize(). The returned normal is normalized.
+*/
+MAGNUM_MESHTOOLS_EXPORT Vector3 decodeNormalOctahedral(const Vector2& encoded);
+
+/**
+@brief Quantize normals to 10-10-10-2 packed integers
+@param normals      Normalized vertex normals
+@return Packed normals and maximal angle in radians between original and
+    decoded normal
+
+Stores the normals as signed normalized 10-bit components with the remaining
+two bits set to zero, so the normal occupies four bytes. Unlike
+@ref quantizeNormalsOctahedral() no change in shader code is needed, the
+attribute can be configured directly as packed generic normal:
+@code
+mesh.addVertexBuffer(buffer, 0, Shaders::Generic3D::PackedNormal{
+    Shaders::Generic3D::PackedNormal::DataType::Int2101010Rev,
+    Shaders::Generic3D::PackedNormal::DataOption::Normalized});
+@endcode
+
+@requires_gl33 %Extension @extension{ARB,vertex_type_2_10_10_10_rev}
+@requires_gles30 Packed types are not available in OpenGL ES 2.0.
+*/
+std::pair<std::vector<UnsignedInt>, Float> MAGNUM_MESHTOOLS_EXPORT quantizeNormalsPacked(const std::vector<Vector3>& normals);
+
+/**
+@brief Quantize texture coordinates to half-floats
+@param textureCoordinates   Texture coordinates
+@return Half-float texture coordinates and maximal absolute difference
+    between original and decoded component
+
+See @ref packHalf() for more information about the conversion. The data are
+meant to be configured as half-float attribute:
+@code
+mesh.addVertexBuffer(buffer, 0, Shaders::Generic3D::TextureCoordinates{
+    Shaders::Generic3D::TextureCoordinates::DataType::HalfFloat});
+@endcode
+
+@requires_gl30 %Extension @extension{NV,half_float} / @extension{ARB,half_float_vertex}
+@requires_gles30 %Extension @es_extension{OES,vertex_half_float} in
+    OpenGL ES 2.0
+*/
+std::pair<std::vector<Math::Vector2<UnsignedShort>>, Float> MAGNUM_MESHTOOLS_EXPORT quantizeTextureCoordinates(const std::vector<Vector2>& textureCoordinates);
+
+/**
+@brief Convert floating-point value to half-float
+
+Rounds to nearest even value, values too large to be represented are
+converted to infinity, NaN is preserved.
+@see @ref unpackHalf()
+*/
+MAGNUM_MESHTOOLS_EXPORT UnsignedShort packHalf(Float value);
+
+/**
+@brief Convert half-float value to floating-point
+
+@see @ref packHalf()
+*/
+MAGNUM_MESHTOOLS_EXPORT Float unpackHalf(UnsignedShort value);
+
+template<class T> std::pair<std::vector<Math::Vector2<T>>, Float> quantizeNormalsOctahedral(const std::vector<Vector3>& normals) {
+    static_assert(std::is_same<T, Byte>::value || std::is_same<T, Short>::value,
+        "MeshTools::quantizeNormalsOctahedral(): only Byte and Short is supported");
+
+    std::vector<Math::Vector2<T>> encoded;
+    encoded.reserve(normals.size());
+    Float error = 0.0f;
+    for(const Vector3& normal: normals) {
+        /* Project onto octahedron, fold the lower hemisphere over */
+        Vector2 projected = normal.xy()/(std::abs(normal.x()) + std::abs(normal.y()) + std::abs(normal.z()));
+        if(normal.z() < 0.0f) projected = Vector2{
+            (1.0f - std::abs(projected.y()))*(projected.x() >= 0.0f ? 1.0f : -1.0f),
+            (1.0f - std::abs(projected.x()))*(projected.y() >= 0.0f ? 1.0f : -1.0f)};
+
+        const Math::Vector2<T> quantized{
+            T(std::round(Math::clamp(projected.x(), -1.0f, 1.0f)*std::numeric_limits<T>::max())),
+            T(std::round(Math::clamp(projected.y(), -1.0f, 1.0f)*std::numeric_limits<T>::max()))};
+        encoded.push_back(quantized);
+
+        const Float cosine = Vector3::dot(decodeNormalOctahedral(Math::normalize<Vector2>(quantized)), normal.normalized());
+        error = Math::max(error, std::acos(Math::clamp(cosine, -1.0f, 1.0f)));
+    }
+
+    return {std::move(encoded), error};
+}
+
+}}
+
+#endif
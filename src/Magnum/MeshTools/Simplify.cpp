@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Subdivide.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Symmetric 4x4 matrix of plane equation products, with accumulated weight */
+struct Quadric {
+    Float a00, a11, a22, a01, a02, a12, b0, b1, b2, c, weight;
+
+    Quadric(): a00(), a11(), a22(), a01(), a02(), a12(), b0(), b1(), b2(), c(), weight() {}
+
+    /* Quadric of plane with given unit normal and distance */
+    explicit Quadric(const Vector3& n, Float d, Float weight): a00(n.x()*n.x()*weight), a11(n.y()*n.y()*weight), a22(n.z()*n.z()*weight), a01(n.x()*n.y()*weight), a02(n.x()*n.z()*weight), a12(n.y()*n.z()*weight), b0(n.x()*d*weight), b1(n.y()*d*weight), b2(n.z()*d*weight), c(d*d*weight), weight(weight) {}
+
+    Quadric& operator+=(const Quadric& other) {
+        a00 += other.a00; a11 += other.a11; a22 += other.a22;
+        a01 += other.a01; a02 += other.a02; a12 += other.a12;
+        b0 += other.b0; b1 += other.b1; b2 += other.b2;
+        c += other.c;
+        weight += other.weight;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const {
+        return Quadric(*this) += other;
+    }
+
+    /* Weighted average of squared distances of the point to all planes */
+    Float error(const Vector3& p) const {
+        const Float e =
+            a00*p.x()*p.x() + a11*p.y()*p.y() + a22*p.z()*p.z() +
+            2.0f*(a01*p.x()*p.y() + a02*p.x()*p.z() + a12*p.y()*p.z()) +
+            2.0f*(b0*p.x() + b1*p.y() + b2*p.z()) + c;
+        return weight == 0.0f ? 0.0f : std::max(e/weight, 0.0f);
+    }
+};
+
+struct Collapse {
+    UnsignedInt from, to;
+    Float error;
+
+    /* Deterministic ordering even for equal errors */
+    bool operator<(const Collapse& other) const {
+        if(error != other.error) return error < other.error;
+        if(from != other.from) return from < other.from;
+        return to < other.to;
+    }
+};
+
+class PositionHash {
+    public:
+        std::size_t operator()(const Vector3& position) const {
+            UnsignedInt data[3];
+            std::memcpy(data, position.data(), sizeof(data));
+            return (data[0]*73856093u) ^ (data[1]*19349663u) ^ (data[2]*83492791u);
+        }
+};
+
+/* Whether replacing position of `from` with position of `to` would flip any
+   triangle around `from` */
+bool flipsTriangle(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& neighborOffset, const std::vector<UnsignedInt>& neighbors, const UnsignedInt from, const UnsignedInt to) {
+    for(UnsignedInt i = neighborOffset[from]; i != neighborOffset[from+1]; ++i) {
+        const UnsignedInt* const triangle = indices.data() + neighbors[i]*3;
+
+        /* Triangles containing both vertices will be removed */
+        if(triangle[0] == to || triangle[1] == to || triangle[2] == to) continue;
+
+        const Vector3 a = positions[triangle[0]];
+        const Vector3 b = positions[triangle[1]];
+        const Vector3 c = positions[triangle[2]];
+        const Vector3 collapsedA = triangle[0] == from ? positions[to] : a;
+        const Vector3 collapsedB = triangle[1] == from ? positions[to] : b;
+        const Vector3 collapsedC = triangle[2] == from ? positions[to] : c;
+
+        if(Vector3::dot(Vector3::cross(b - a, c - a), Vector3::cross(collapsedB - collapsedA, collapsedC - collapsedA)) <= 0.0f)
+            return true;
+    }
+
+    return false;
+}
+
+}
+
+Float simplify(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::simplify(): index count is not divisible by 3!", {});
+
+    const UnsignedInt vertexCount = positions.size();
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::simplify(): index out of range", {});
+    #endif
+
+    /* Vertices sharing position with other vertices are on attribute seams
+       and can't be moved without tearing the mesh apart. For the rest
+       compute the position-only index, so borders are detected properly even
+       if the mesh has seams. */
+    std::vector<UnsignedInt> positionIndex(vertexCount);
+    std::vector<bool> locked(vertexCount);
+    {
+        std::unordered_map<Vector3, UnsignedInt, PositionHash> uniquePositions(vertexCount);
+        for(UnsignedInt i = 0; i != vertexCount; ++i) {
+            #ifndef CORRADE_GCC46_COMPATIBILITY
+            const auto result = uniquePositions.emplace(positions[i], i);
+            #else
+            const auto result = uniquePositions.insert({positions[i], i});
+            #endif
+            positionIndex[i] = result.first->second;
+            if(!result.second) locked[i] = locked[result.first->second] = true;
+        }
+    }
+
+    /* Border and non-manifold edges have other than two adjacent triangles.
+       Lock their vertices so the borders are preserved. */
+    {
+        std::unordered_map<UnsignedLong, UnsignedInt> edgeTriangleCount(indices.size());
+        for(std::size_t i = 0; i != indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j)
+            ++edgeTriangleCount[Implementation::edgeKey(positionIndex[indices[i+j]], positionIndex[indices[i+(j+1)%3]])];
+        for(std::size_t i = 0; i != indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = indices[i+j], b = indices[i+(j+1)%3];
+            if(edgeTriangleCount[Implementation::edgeKey(positionIndex[a], positionIndex[b])] != 2)
+                locked[a] = locked[b] = true;
+        }
+    }
+
+    /* Quadrics of all planes around each vertex, weighted by triangle area */
+    std::vector<Quadric> quadrics(vertexCount);
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3& a = positions[indices[i]];
+        const Vector3& b = positions[indices[i+1]];
+        const Vector3& c = positions[indices[i+2]];
+        const Vector3 normal = Vector3::cross(b - a, c - a);
+        const Float area = normal.length();
+        if(area == 0.0f) continue;
+
+        const Vector3 unitNormal = normal/area;
+        const Quadric quadric(unitNormal, -Vector3::dot(unitNormal, a), area);
+        for(std::size_t j = 0; j != 3; ++j) quadrics[indices[i+j]] += quadric;
+    }
+
+    const Float targetErrorSquared = targetError == std::numeric_limits<Float>::max() ?
+        targetError : targetError*targetError;
+    Float resultErrorSquared = 0.0f;
+
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    std::vector<Collapse> collapses;
+    std::vector<UnsignedInt> collapseRemap(vertexCount);
+    std::vector<bool> vertexTouched(vertexCount);
+    while(indices.size() > targetIndexCount) {
+        /* Vertex-triangle adjacency for current index array */
+        Implementation::Tipsify(indices, vertexCount).buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+        /* Cheapest collapse direction for each edge */
+        collapses.clear();
+        for(std::size_t i = 0; i != indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = indices[i+j], b = indices[i+(j+1)%3];
+
+            /* Consider each edge only once (the other triangle has it in
+               opposite direction), border edges are locked anyway */
+            if(a > b || (locked[a] && locked[b])) continue;
+
+            const Quadric quadric = quadrics[a] + quadrics[b];
+            const Float errorAB = locked[a] ? std::numeric_limits<Float>::max() : quadric.error(positions[b]);
+            const Float errorBA = locked[b] ? std::numeric_limits<Float>::max() : quadric.error(positions[a]);
+            const Collapse collapse = errorAB <= errorBA ?
+                Collapse{a, b, errorAB} : Collapse{b, a, errorBA};
+            if(collapse.error <= targetErrorSquared) collapses.push_back(collapse);
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        /* Each collapse removes two triangles, don't do more than needed */
+        const std::size_t collapseLimit = std::max(std::size_t(1), (indices.size() - targetIndexCount)/6);
+
+        /* Do independent collapses, locking the neighborhood of each
+           collapsed vertex for the rest of the pass so the flip check
+           always sees current positions */
+        for(UnsignedInt i = 0; i != vertexCount; ++i) collapseRemap[i] = i;
+        std::fill(vertexTouched.begin(), vertexTouched.end(), false);
+        std::size_t collapseCount = 0;
+        for(const Collapse& collapse: collapses) {
+            if(collapseCount == collapseLimit) break;
+            if(vertexTouched[collapse.from] || vertexTouched[collapse.to]) continue;
+            if(flipsTriangle(indices, positions, neighborOffset, neighbors, collapse.from, collapse.to)) continue;
+
+            for(UnsignedInt k = neighborOffset[collapse.from]; k != neighborOffset[collapse.from+1]; ++k)
+                for(std::size_t j = 0; j != 3; ++j)
+                    vertexTouched[indices[neighbors[k]*3 + j]] = true;
+
+            collapseRemap[collapse.from] = collapse.to;
+            quadrics[collapse.to] += quadrics[collapse.from];
+            resultErrorSquared = std::max(resultErrorSquared, collapse.error);
+            ++collapseCount;
+        }
+
+        /* Nothing more can be collapsed */
+        if(!collapseCount) break;
+
+        /* Remap the indices and remove triangles which became degenerate */
+        std::size_t outputSize = 0;
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            const UnsignedInt a = collapseRemap[indices[i]];
+            const UnsignedInt b = collapseRemap[indices[i+1]];
+            const UnsignedInt c = collapseRemap[indices[i+2]];
+            if(a == b || b == c || c == a) continue;
+
+            indices[outputSize++] = a;
+            indices[outputSize++] = b;
+            indices[outputSize++] = c;
+        }
+        indices.resize(outputSize);
+    }
+
+    return std::sqrt(resultErrorSquared);
+}
+
+std::vector<std::vector<UnsignedInt>> generateLods(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t levelCount, const Float reduction, const Float targetError) {
+    CORRADE_ASSERT(reduction > 0.0f && reduction < 1.0f, "MeshTools::generateLods(): reduction must be between 0 and 1, got" << reduction, {});
+
+    std::vector<std::vector<UnsignedInt>> levels;
+    if(!levelCount) return levels;
+    levels.reserve(levelCount);
+    levels.push_back(indices);
+
+    while(levels.size() != levelCount) {
+        std::vector<UnsignedInt> level = levels.back();
+        simplify(level, positions, std::size_t(level.size()*reduction)/3*3, targetError);
+
+        /* Stop if the mesh can't be simplified further */
+        if(level.size() == levels.back().size()) break;
+
+        levels.push_back(std::move(level));
+    }
+
+    return levels;
+}
+
+}}
@@ -0,0 +1,98 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::generateLods()
+ */
+
+#include <limits>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify the mesh
+@param[in,out] indices      Index array to operate on
+@param[in] positions        Vertex positions
+@param[in] targetIndexCount Target index count
+@param[in] targetError      Maximal allowed error
+@return Error of the simplified mesh
+
+Reduces triangle count of the mesh using iterative edge collapse driven by
+quadric error metric. Algorithm used: *Michael Garland and Paul S. Heckbert -
+Surface Simplification Using Quadric Error Metrics, SIGGRAPH 1997*. The
+collapses are done in passes, each pass collapsing the cheapest independent
+edges, until the index count is at or below @p targetIndexCount or no edge
+can be collapsed without exceeding @p targetError. Both the error limit and
+the returned error are expressed as distance in the units of @p positions.
+
+Vertices are collapsed only onto other existing vertices, thus the attribute
+arrays (positions, normals, texture coordinates...) don't need to be modified
+in any way, only the index array changes. Some vertices might become unused
+after the simplification. Mesh borders and vertices which share the same
+position with other vertices (e.g. on texture coordinate or normal seams) are
+never moved, so holes and seams are preserved exactly. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+Float error = MeshTools::simplify(indices, positions, indices.size()/4, 0.01f);
+@endcode
+
+@attention Index count must be divisible by 3.
+@see @ref generateLods()
+*/
+Float MAGNUM_MESHTOOLS_EXPORT simplify(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t targetIndexCount, Float targetError = std::numeric_limits<Float>::max());
+
+/**
+@brief Generate chain of levels of detail
+@param indices      Index array
+@param positions    Vertex positions
+@param levelCount   Max count of generated levels, including the original one
+@param reduction    Ratio of index count between two consecutive levels
+@param targetError  Maximal allowed error
+@return Index arrays for each level, the first being the original one
+
+Repeatedly calls @ref simplify() on the previous level, so each level is
+progressively refined from the previous one. All levels share the same
+vertex data. Generation stops earlier if the mesh can't be simplified further
+without exceeding @p targetError. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<std::vector<UnsignedInt>> lods = MeshTools::generateLods(indices, positions, 5);
+@endcode
+*/
+std::vector<std::vector<UnsignedInt>> MAGNUM_MESHTOOLS_EXPORT generateLods(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t levelCount, Float reduction = 0.5f, Float targetError = std::numeric_limits<Float>::max());
+
+}}
+
+#endif
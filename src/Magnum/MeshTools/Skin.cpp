@@ -0,0 +1,110 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Skin.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Blending functions, producing affine transformation for given vertex */
+struct LinearBlend {
+    static Matrix4 blend(const std::vector<Matrix4>& joints, const Vector4ui& indices, const Vector4& weights) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != 4; ++i)
+            if(weights[i] != 0.0f) out += joints[indices[i]]*weights[i];
+        return out;
+    }
+};
+
+struct DualQuaternionBlend {
+    static Matrix4 blend(const std::vector<DualQuaternion>& joints, const Vector4ui& indices, const Vector4& weights) {
+        Quaternion first, real{{}, 0.0f}, dual{{}, 0.0f};
+        bool hasFirst = false;
+        for(std::size_t i = 0; i != 4; ++i) {
+            if(weights[i] == 0.0f) continue;
+
+            const DualQuaternion& joint = joints[indices[i]];
+            if(!hasFirst) {
+                first = joint.real();
+                hasFirst = true;
+            }
+
+            /* Flip to the same hemisphere as the first joint, q and -q
+               represent the same transformation */
+            const Float weight = Quaternion::dot(first, joint.real()) < 0.0f ? -weights[i] : weights[i];
+            real += joint.real()*weight;
+            dual += joint.dual()*weight;
+        }
+
+        /* Normalize, then convert to matrix. Rotation is given by the real
+           part, translation is 2 d r* */
+        const Float length = real.length();
+        real /= length;
+        dual /= length;
+        return Matrix4::from(real.toMatrix(), (dual*real.conjugated()).vector()*2.0f);
+    }
+};
+
+template<class Blend, class T> void skinImplementation(const std::vector<T>& joints, const std::vector<Vector4ui>& jointIndices, const std::vector<Vector4>& jointWeights, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, std::vector<Vector3>& outPositions, std::vector<Vector3>& outNormals) {
+    CORRADE_ASSERT(jointIndices.size() == positions.size() && jointWeights.size() == positions.size(),
+        "MeshTools::skin(): joint index and weight count doesn't match vertex count", );
+    CORRADE_ASSERT(normals.empty() || normals.size() == positions.size(),
+        "MeshTools::skin(): normal count doesn't match vertex count", );
+
+    outPositions.resize(positions.size());
+    if(!normals.empty()) outNormals.resize(normals.size());
+
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Vector4ui& indices = jointIndices[i];
+        #ifndef CORRADE_NO_ASSERT
+        for(std::size_t j = 0; j != 4; ++j)
+            CORRADE_ASSERT(jointWeights[i][j] == 0.0f || indices[j] < joints.size(),
+                "MeshTools::skin(): joint index out of range", );
+        #endif
+
+        const Matrix4 transformation = Blend::blend(joints, indices, jointWeights[i]);
+        outPositions[i] = transformation.transformPoint(positions[i]);
+        if(!normals.empty())
+            outNormals[i] = transformation.transformVector(normals[i]).normalized();
+    }
+}
+
+}
+
+void skin(const std::vector<Matrix4>& joints, const std::vector<Vector4ui>& jointIndices, const std::vector<Vector4>& jointWeights, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, std::vector<Vector3>& outPositions, std::vector<Vector3>& outNormals) {
+    skinImplementation<LinearBlend>(joints, jointIndices, jointWeights, positions, normals, outPositions, outNormals);
+}
+
+void skin(const std::vector<DualQuaternion>& joints, const std::vector<Vector4ui>& jointIndices, const std::vector<Vector4>& jointWeights, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, std::vector<Vector3>& outPositions, std::vector<Vector3>& outNormals) {
+    skinImplementation<DualQuaternionBlend>(joints, jointIndices, jointWeights, positions, normals, outPositions, outNormals);
+}
+
+}}
@@ -0,0 +1,96 @@
+#ifndef Magnum_MeshTools_Skin_h
+#define Magnum_MeshTools_Skin_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::skin()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Skin mesh using linear blend skinning
+@param[in] joints           Joint palette
+@param[in] jointIndices     Indices of up to four joints affecting each
+    vertex
+@param[in] jointWeights     Weights of the joints for each vertex
+@param[in] positions        Bind-pose vertex positions
+@param[in] normals          Bind-pose vertex normals, can be empty
+@param[out] outPositions    Skinned positions
+@param[out] outNormals      Skinned normals, left untouched if @p normals
+    is empty
+
+Each palette entry is expected to be joint world transformation multiplied
+with its inverse bind matrix. Each vertex is transformed with weighted sum
+of the joint matrices, joints with zero weight are skipped, so vertices
+affected by less than four joints can have arbitrary index in the unused
+slots. The weights are expected to sum up to `1`. Normals are transformed
+with rotation and scaling part of the blended matrix and renormalized, which
+is correct for joint transformations without non-uniform scaling.
+
+The output arrays are resized to vertex count and can be reused between
+frames to avoid reallocations. The function has no global state, so
+multiple meshes (e.g. characters in a crowd) can be skinned in parallel from
+different threads. Example usage:
+@code
+std::vector<Vector4ui> jointIndices;
+std::vector<Vector4> jointWeights;
+std::vector<Vector3> positions, normals;
+
+std::vector<Matrix4> joints;
+std::vector<Vector3> skinnedPositions, skinnedNormals;
+MeshTools::skin(joints, jointIndices, jointWeights, positions, normals,
+    skinnedPositions, skinnedNormals);
+@endcode
+
+@attention All per-vertex arrays (except empty @p normals) must have the
+    same size and all joint indices must be in range of @p joints.
+@see @ref skin(const std::vector<DualQuaternion>&, const std::vector<Vector4ui>&, const std::vector<Vector4>&, const std::vector<Vector3>&, const std::vector<Vector3>&, std::vector<Vector3>&, std::vector<Vector3>&),
+    @ref transformPoints()
+*/
+void MAGNUM_MESHTOOLS_EXPORT skin(const std::vector<Matrix4>& joints, const std::vector<Vector4ui>& jointIndices, const std::vector<Vector4>& jointWeights, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, std::vector<Vector3>& outPositions, std::vector<Vector3>& outNormals);
+
+/**
+@brief Skin mesh using dual quaternion skinning
+
+Same as @ref skin(const std::vector<Matrix4>&, const std::vector<Vector4ui>&, const std::vector<Vector4>&, const std::vector<Vector3>&, const std::vector<Vector3>&, std::vector<Vector3>&, std::vector<Vector3>&),
+but the joint palette consists of normalized dual quaternions, which are
+blended linearly and renormalized. Unlike linear blend skinning this
+preserves volume around twisting and bending joints (no "candy-wrapper"
+artifacts), but doesn't support scaling. Dual quaternions are flipped to the
+same hemisphere as the first affecting joint before blending, so the
+shortest path is always taken.
+*/
+void MAGNUM_MESHTOOLS_EXPORT skin(const std::vector<DualQuaternion>& joints, const std::vector<Vector4ui>& jointIndices, const std::vector<Vector4>& jointWeights, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, std::vector<Vector3>& outPositions, std::vector<Vector3>& outNormals);
+
+}}
+
+#endif
@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SpatialSort.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+
+namespace {
+    /* Spreads lower 10 bits to every third bit */
+    inline UnsignedInt part1By2(UnsignedInt x) {
+        x &= 0x000003ff;
+        x = (x ^ (x << 16)) & 0xff0000ff;
+        x = (x ^ (x <<  8)) & 0x0300f00f;
+        x = (x ^ (x <<  4)) & 0x030c30c3;
+        x = (x ^ (x <<  2)) & 0x09249249;
+        return x;
+    }
+}
+
+UnsignedInt mortonKey(const UnsignedInt x, const UnsignedInt y, const UnsignedInt z) {
+    return (part1By2(x) << 2)|(part1By2(y) << 1)|part1By2(z);
+}
+
+/* Based on John Skilling, "Programming the Hilbert curve", AIP Conference
+   Proceedings 707, 2004. Converts the coordinates to "transposed" Hilbert
+   index, which is then interleaved to get the key. */
+UnsignedInt hilbertKey(UnsignedInt x, UnsignedInt y, UnsignedInt z) {
+    UnsignedInt v[]{x, y, z};
+
+    /* Inverse undo */
+    for(UnsignedInt q = 1 << 9; q > 1; q >>= 1) {
+        const UnsignedInt p = q - 1;
+        for(UnsignedInt& i: v) {
+            if(i & q) v[0] ^= p;
+            else {
+                const UnsignedInt t = (v[0] ^ i) & p;
+                v[0] ^= t;
+                i ^= t;
+            }
+        }
+    }
+
+    /* Gray encode */
+    v[1] ^= v[0];
+    v[2] ^= v[1];
+    UnsignedInt t = 0;
+    for(UnsignedInt q = 1 << 9; q > 1; q >>= 1)
+        if(v[2] & q) t ^= q - 1;
+    for(UnsignedInt& i: v) i ^= t;
+
+    return mortonKey(v[0], v[1], v[2]);
+}
+
+}
+
+namespace {
+
+/* Sorts the values by 30-bit keys in three stable 10-bit passes */
+std::vector<UnsignedInt> radixSort(std::vector<UnsignedInt>& keys) {
+    std::vector<UnsignedInt> values(keys.size()), outKeys(keys.size()), outValues(keys.size());
+    for(std::size_t i = 0; i != values.size(); ++i) values[i] = i;
+
+    for(UnsignedInt shift = 0; shift != 30; shift += 10) {
+        std::vector<std::size_t> offsets(1024);
+        for(UnsignedInt key: keys) ++offsets[(key >> shift) & 1023];
+        std::size_t offset = 0;
+        for(std::size_t& i: offsets) {
+            const std::size_t count = i;
+            i = offset;
+            offset += count;
+        }
+
+        for(std::size_t i = 0; i != keys.size(); ++i) {
+            const std::size_t to = offsets[(keys[i] >> shift) & 1023]++;
+            outKeys[to] = keys[i];
+            outValues[to] = values[i];
+        }
+
+        std::swap(keys, outKeys);
+        std::swap(values, outValues);
+    }
+
+    return values;
+}
+
+/* Quantizes the points uniformly into 10-bit grid and calculates the keys */
+template<class T> std::vector<UnsignedInt> keys(const std::size_t count, const T& point, const SpatialCurve curve) {
+    std::vector<UnsignedInt> keys(count);
+    if(!count) return keys;
+
+    Vector3 min = point(0), max = min;
+    for(std::size_t i = 1; i != count; ++i) {
+        min = Math::min(min, point(i));
+        max = Math::max(max, point(i));
+    }
+    const Float extent = (max - min).max();
+    const Float scale = extent == 0.0f ? 0.0f : 1023.0f/extent;
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const Vector3 p = (point(i) - min)*scale + Vector3(0.5f);
+        const UnsignedInt x = Math::min(UnsignedInt(p.x()), 1023u),
+            y = Math::min(UnsignedInt(p.y()), 1023u),
+            z = Math::min(UnsignedInt(p.z()), 1023u);
+        keys[i] = curve == SpatialCurve::Morton ?
+            Implementation::mortonKey(x, y, z) :
+            Implementation::hilbertKey(x, y, z);
+    }
+
+    return keys;
+}
+
+}
+
+std::vector<UnsignedInt> spatialSortVertices(const std::vector<Vector3>& positions, const SpatialCurve curve) {
+    std::vector<UnsignedInt> k = keys(positions.size(), [&positions](std::size_t i) { return positions[i]; }, curve);
+    return radixSort(k);
+}
+
+std::vector<UnsignedInt> spatialSortVertices(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const SpatialCurve curve) {
+    std::vector<UnsignedInt> mapping = spatialSortVertices(positions, curve);
+
+    std::vector<UnsignedInt> remap(mapping.size());
+    for(std::size_t i = 0; i != mapping.size(); ++i) remap[mapping[i]] = i;
+    for(UnsignedInt& index: indices) {
+        CORRADE_ASSERT(index < remap.size(), "MeshTools::spatialSortVertices(): index out of range", mapping);
+        index = remap[index];
+    }
+
+    return mapping;
+}
+
+void spatialSortTriangles(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const SpatialCurve curve) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::spatialSortTriangles(): index count is not divisible by 3", );
+    for(UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::spatialSortTriangles(): index out of range", );
+
+    std::vector<UnsignedInt> k = keys(indices.size()/3, [&indices, &positions](std::size_t i) {
+        return (positions[indices[i*3]] + positions[indices[i*3 + 1]] + positions[indices[i*3 + 2]])/3.0f;
+    }, curve);
+    const std::vector<UnsignedInt> order = radixSort(k);
+
+    std::vector<UnsignedInt> out(indices.size());
+    for(std::size_t i = 0; i != order.size(); ++i) for(std::size_t j = 0; j != 3; ++j)
+        out[i*3 + j] = indices[order[i]*3 + j];
+    indices = std::move(out);
+}
+
+}}
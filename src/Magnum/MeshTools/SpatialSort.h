@@ -0,0 +1,118 @@
+#ifndef Magnum_MeshTools_SpatialSort_h
+#define Magnum_MeshTools_SpatialSort_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::MeshTools::SpatialCurve, function @ref Magnum::MeshTools::spatialSortVertices(), @ref Magnum::MeshTools::spatialSortTriangles()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+    /* Keys for 10-bit coordinates */
+    MAGNUM_MESHTOOLS_EXPORT UnsignedInt mortonKey(UnsignedInt x, UnsignedInt y, UnsignedInt z);
+    MAGNUM_MESHTOOLS_EXPORT UnsignedInt hilbertKey(UnsignedInt x, UnsignedInt y, UnsignedInt z);
+}
+
+/**
+@brief Space-filling curve
+
+@see @ref spatialSortVertices(), @ref spatialSortTriangles()
+*/
+enum class SpatialCurve: UnsignedByte {
+    /**
+     * Morton (Z-order) curve. Faster to compute, but has large jumps between
+     * some neighboring cells.
+     */
+    Morton,
+
+    /**
+     * Hilbert curve. Consecutive cells are always adjacent, which gives
+     * better locality.
+     */
+    Hilbert
+};
+
+/**
+@brief Sort vertices along space-filling curve
+@param positions    Vertex positions
+@param curve        Space-filling curve
+@return Vertex mapping
+
+The positions are quantized to 10 bits per axis inside their bounding box,
+converted to keys along given curve and sorted using radix sort. Returns
+original index of each vertex in the new order, use @ref duplicate() to
+reorder the positions and any other vertex attributes. Useful for
+improving locality of point clouds and unordered meshes. Example usage:
+@code
+std::vector<Vector3> positions;
+std::vector<Color3> colors;
+
+std::vector<UnsignedInt> mapping = MeshTools::spatialSortVertices(positions);
+positions = MeshTools::duplicate(mapping, positions);
+colors = MeshTools::duplicate(mapping, colors);
+@endcode
+@see @ref spatialSortTriangles()
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT spatialSortVertices(const std::vector<Vector3>& positions, SpatialCurve curve = SpatialCurve::Hilbert);
+
+/**
+@brief Sort vertices of indexed mesh along space-filling curve
+@param[in,out] indices  Index array to remap
+@param[in] positions    Vertex positions
+@param[in] curve        Space-filling curve
+@return Vertex mapping
+
+Same as @ref spatialSortVertices(const std::vector<Vector3>&, SpatialCurve),
+but additionally remaps @p indices to the new vertex order.
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT spatialSortVertices(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, SpatialCurve curve = SpatialCurve::Hilbert);
+
+/**
+@brief Sort triangles along space-filling curve
+@param[in,out] indices  Triangle index array
+@param[in] positions    Vertex positions
+@param[in] curve        Space-filling curve
+
+Reorders the triangles in-place by key of their centroid, see
+@ref spatialSortVertices() for more information. Calling
+@ref spatialSortVertices(std::vector<UnsignedInt>&, const std::vector<Vector3>&, SpatialCurve)
+afterwards orders also the vertices. For best vertex cache efficiency you
+might want to use @ref tipsify() afterwards, which benefits from the
+improved locality of the input.
+
+@attention Index count must be divisible by 3.
+*/
+void MAGNUM_MESHTOOLS_EXPORT spatialSortTriangles(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, SpatialCurve curve = SpatialCurve::Hilbert);
+
+}}
+
+#endif
@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SplitIndices.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::vector<std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>>> splitIndices(const std::vector<UnsignedInt>& indices, const UnsignedInt maxVertices) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::splitIndices(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(maxVertices >= 3, "MeshTools::splitIndices(): expected at least 3 vertices but got" << maxVertices, {});
+
+    std::vector<std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>>> chunks;
+    if(indices.empty()) return chunks;
+
+    /* Local index of each original vertex in current chunk, reset using the
+       chunk vertex mapping when the chunk is finished */
+    constexpr UnsignedInt Unused = ~UnsignedInt{};
+    std::vector<UnsignedInt> local(*std::max_element(indices.begin(), indices.end()) + 1, Unused);
+
+    std::vector<UnsignedInt> chunkIndices, chunkVertices;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i], b = indices[i + 1], c = indices[i + 2];
+
+        /* Finish current chunk if the new vertices wouldn't fit */
+        const UnsignedInt newVertexCount =
+            (local[a] == Unused) +
+            (local[b] == Unused && b != a) +
+            (local[c] == Unused && c != a && c != b);
+        if(chunkVertices.size() + newVertexCount > maxVertices) {
+            for(UnsignedInt vertex: chunkVertices) local[vertex] = Unused;
+            chunks.emplace_back(std::move(chunkIndices), std::move(chunkVertices));
+            chunkIndices = {};
+            chunkVertices = {};
+        }
+
+        for(UnsignedInt index: {a, b, c}) {
+            if(local[index] == Unused) {
+                local[index] = chunkVertices.size();
+                chunkVertices.push_back(index);
+            }
+            chunkIndices.push_back(local[index]);
+        }
+    }
+
+    chunks.emplace_back(std::move(chunkIndices), std::move(chunkVertices));
+    return chunks;
+}
+
+std::vector<Trade::MeshData3D> splitIndices(const Trade::MeshData3D& meshData, const UnsignedInt maxVertices) {
+    CORRADE_ASSERT(meshData.isIndexed() && meshData.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::splitIndices(): expected indexed triangle mesh", {});
+
+    std::vector<Trade::MeshData3D> out;
+    for(auto& chunk: splitIndices(meshData.indices(), maxVertices)) {
+        const std::vector<UnsignedInt>& mapping = std::get<1>(chunk);
+
+        std::vector<std::vector<Vector3>> positions, normals;
+        std::vector<std::vector<Vector2>> textureCoords2D;
+        for(UnsignedInt i = 0; i != meshData.positionArrayCount(); ++i)
+            positions.push_back(duplicate(mapping, meshData.positions(i)));
+        for(UnsignedInt i = 0; i != meshData.normalArrayCount(); ++i)
+            normals.push_back(duplicate(mapping, meshData.normals(i)));
+        for(UnsignedInt i = 0; i != meshData.textureCoords2DArrayCount(); ++i)
+            textureCoords2D.push_back(duplicate(mapping, meshData.textureCoords2D(i)));
+
+        out.emplace_back(MeshPrimitive::Triangles, std::move(std::get<0>(chunk)), std::move(positions), std::move(normals), std::move(textureCoords2D));
+    }
+
+    return out;
+}
+
+}}
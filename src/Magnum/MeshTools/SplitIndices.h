@@ -0,0 +1,86 @@
+#ifndef Magnum_MeshTools_SplitIndices_h
+#define Magnum_MeshTools_SplitIndices_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::splitIndices()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Split triangle mesh into chunks with limited vertex count
+@param indices      Triangle index array
+@param maxVertices  Max unique vertex count in one chunk, at least `3`
+@return Index array and vertex mapping for each chunk
+
+Goes through the triangles in order and adds them to current chunk until
+the vertex limit would be exceeded, so the triangle order and vertex cache
+locality of the input is preserved. Indices of each chunk are local to the
+chunk, i.e. less than @p maxVertices, and with the default limit they can be
+stored in 16-bit type using @ref compressIndices(). The vertex mapping
+contains original index of each chunk vertex, use @ref duplicate() to extract
+the vertex subset. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+for(const auto& chunk: MeshTools::splitIndices(indices)) {
+    const std::vector<UnsignedInt>& chunkIndices = std::get<0>(chunk);
+    std::vector<Vector3> chunkPositions = MeshTools::duplicate(std::get<1>(chunk), positions);
+    // ...
+}
+@endcode
+
+@attention Index count must be divisible by 3.
+@see @ref splitIndices(const Trade::MeshData3D&, UnsignedInt)
+*/
+std::vector<std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>>> MAGNUM_MESHTOOLS_EXPORT splitIndices(const std::vector<UnsignedInt>& indices, UnsignedInt maxVertices = 65536);
+
+/**
+@brief Split triangle mesh data into chunks with limited vertex count
+@param meshData     Indexed triangle mesh
+@param maxVertices  Max vertex count in one chunk, at least `3`
+
+Splits the indices using @ref splitIndices(const std::vector<UnsignedInt>&, UnsignedInt)
+and extracts subset of all position, normal and texture coordinate arrays
+for each chunk, so each of them can be passed directly to @ref compile().
+
+@attention The mesh must be indexed and its primitive must be
+    @ref MeshPrimitive::Triangles.
+*/
+std::vector<Trade::MeshData3D> MAGNUM_MESHTOOLS_EXPORT splitIndices(const Trade::MeshData3D& meshData, UnsignedInt maxVertices = 65536);
+
+}}
+
+#endif
@@ -0,0 +1,663 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* 64-bit file offsets for the temporary files on 32-bit POSIX systems, needs
+   to be defined before any system header is included */
+#ifndef _WIN32
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include "Streaming.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+#include "Magnum/MeshTools/EncodeIndices.h"
+#include "Magnum/MeshTools/Implementation/Hash.h"
+
+namespace Magnum { namespace MeshTools { namespace Streaming {
+
+namespace {
+
+enum: std::size_t {
+    PageSize = 64*1024,             /* Size of paged array page in bytes */
+    NoPage = ~std::size_t{}
+};
+
+template<class T> bool read(std::istream& in, T* const data, const std::size_t count) {
+    in.read(reinterpret_cast<char*>(data), count*sizeof(T));
+    return std::size_t(in.gcount()) == count*sizeof(T);
+}
+
+/* Bytes remaining in the stream, or maximal value if the stream doesn't
+   support seeking */
+std::size_t remaining(std::istream& in) {
+    const std::istream::pos_type current = in.tellg();
+    if(current == std::istream::pos_type(-1)) return ~std::size_t{};
+    in.seekg(0, std::ios::end);
+    const std::istream::pos_type end = in.tellg();
+    in.seekg(current);
+    if(end == std::istream::pos_type(-1) || !in) {
+        in.clear();
+        return ~std::size_t{};
+    }
+    return std::size_t(end - current);
+}
+
+template<class T> bool write(std::ostream& out, const T* const data, const std::size_t count) {
+    out.write(reinterpret_cast<const char*>(data), count*sizeof(T));
+    return bool(out);
+}
+
+/* Seek in a file with 64-bit offset, plain std::fseek() takes long, which
+   is 32-bit on Windows and 32-bit targets */
+bool seek(std::FILE* const file, const UnsignedLong offset) {
+    #ifdef _WIN32
+    return offset <= UnsignedLong(std::numeric_limits<__int64>::max()) &&
+        _fseeki64(file, __int64(offset), SEEK_SET) == 0;
+    #else
+    return offset <= UnsignedLong(std::numeric_limits<off_t>::max()) &&
+        fseeko(file, off_t(offset), SEEK_SET) == 0;
+    #endif
+}
+
+/* Maximal encoded size of one triangle in MeshTools::encodeIndices(), two
+   code bytes and three 32-bit varints, must be kept in sync with
+   EncodeIndices.cpp */
+constexpr std::size_t MaxEncodedTriangleSize = 2 + 3*5;
+
+/* Element count of a chunk taking at most given memory, at least one item */
+template<class T> inline std::size_t chunkSize(const std::size_t memory, const std::size_t multiple = 1) {
+    return std::max(memory/sizeof(T)/multiple, std::size_t(1))*multiple;
+}
+
+/* Temporary file, deleted on destruction */
+class TemporaryFile {
+    public:
+        explicit TemporaryFile(): _file(std::tmpfile()) {}
+
+        TemporaryFile(const TemporaryFile&) = delete;
+        TemporaryFile(TemporaryFile&& other): _file(other._file) { other._file = nullptr; }
+
+        ~TemporaryFile() { if(_file) std::fclose(_file); }
+
+        TemporaryFile& operator=(const TemporaryFile&) = delete;
+        TemporaryFile& operator=(TemporaryFile&&) = delete;
+
+        explicit operator bool() const { return _file; }
+
+        std::FILE* operator*() const { return _file; }
+
+    private:
+        std::FILE* _file;
+};
+
+/* Array stored in temporary file, with least recently used pages cached in
+   memory. Pages which were never written are zero-initialized. If reading
+   or writing the temporary file fails, the array is put into failed state
+   (checked with the boolean conversion) and accesses return zeros. */
+template<class T> class PagedArray {
+    public:
+        explicit PagedArray(const std::size_t size, const std::size_t memoryLimit): _pageSize{std::max(std::size_t(PageSize)/sizeof(T), std::size_t(1))}, _written((size + _pageSize - 1)/_pageSize), _slots(_written.size(), NoPage), _time{}, _failed{} {
+            _pages.resize(std::min(std::max(memoryLimit/(_pageSize*sizeof(T)), std::size_t(2)), _written.size()));
+        }
+
+        explicit operator bool() const { return _file && !_failed; }
+
+        T get(const std::size_t i) { return page(i/_pageSize, false)[i%_pageSize]; }
+
+        T& at(const std::size_t i) { return page(i/_pageSize, true)[i%_pageSize]; }
+
+    private:
+        struct Page {
+            std::vector<T> data;
+            std::size_t id = NoPage;
+            UnsignedLong lastUse = 0;
+            bool dirty = false;
+        };
+
+        T* page(const std::size_t id, const bool dirty) {
+            std::size_t slot = _slots[id];
+            if(slot == NoPage) slot = load(id);
+
+            Page& page = _pages[slot];
+            page.lastUse = ++_time;
+            page.dirty |= dirty;
+            return page.data.data();
+        }
+
+        std::size_t load(const std::size_t id) {
+            /* Evict least recently used page, write it back if changed */
+            std::size_t slot = 0;
+            for(std::size_t i = 1; i != _pages.size(); ++i)
+                if(_pages[i].lastUse < _pages[slot].lastUse) slot = i;
+            Page& page = _pages[slot];
+            if(page.id != NoPage) {
+                if(page.dirty) {
+                    if(seek(*_file, UnsignedLong(page.id)*_pageSize*sizeof(T)) &&
+                       std::fwrite(page.data.data(), sizeof(T), _pageSize, *_file) == _pageSize)
+                        _written[page.id] = true;
+                    else _failed = true;
+                }
+                _slots[page.id] = NoPage;
+            }
+
+            /* Load the new one */
+            page.data.resize(_pageSize);
+            if(!_written[id] || !seek(*_file, UnsignedLong(id)*_pageSize*sizeof(T)) ||
+               std::fread(page.data.data(), sizeof(T), _pageSize, *_file) != _pageSize) {
+                if(_written[id]) _failed = true;
+                std::fill(page.data.begin(), page.data.end(), T{});
+            }
+            page.id = id;
+            page.dirty = false;
+            _slots[id] = slot;
+            return slot;
+        }
+
+        TemporaryFile _file;
+        const std::size_t _pageSize;
+        std::vector<bool> _written;
+        std::vector<std::size_t> _slots;
+        std::vector<Page> _pages;
+        UnsignedLong _time;
+        bool _failed;
+};
+
+/* Copies given count of items from the stream into paged array */
+template<class T> bool copy(std::istream& in, PagedArray<T>& out, const std::size_t count, const std::size_t memoryLimit) {
+    std::vector<T> chunk(std::min(chunkSize<T>(memoryLimit), count));
+    for(std::size_t offset = 0; offset < count; offset += chunk.size()) {
+        const std::size_t size = std::min(chunk.size(), count - offset);
+        if(!read(in, chunk.data(), size)) return false;
+        for(std::size_t i = 0; i != size; ++i) out.at(offset + i) = chunk[i];
+    }
+    return bool(out);
+}
+
+struct PositionEntry {
+    Vector3 position;
+    UnsignedInt index;
+};
+
+/* Ordering by position bits and original index, which makes the output
+   deterministic */
+bool lessPositionEntry(const PositionEntry& a, const PositionEntry& b) {
+    const int result = std::memcmp(a.position.data(), b.position.data(), sizeof(Vector3));
+    return result < 0 || (result == 0 && a.index < b.index);
+}
+
+}
+
+bool removeDuplicates(std::istream& positions, const std::size_t vertexCount, std::istream& indices, const std::size_t indexCount, std::ostream& outPositions, std::ostream& outIndices, std::size_t& outVertexCount, const std::size_t memoryLimit) {
+    outVertexCount = 0;
+
+    /* Partition count such that each partition fits into quarter of the
+       memory, leaving the rest to I/O buffers and the remap table */
+    const std::size_t partitionSize = chunkSize<PositionEntry>(memoryLimit/4);
+    const std::size_t partitionCount = (vertexCount + partitionSize - 1)/partitionSize;
+    std::vector<TemporaryFile> partitions;
+    partitions.reserve(partitionCount);
+    for(std::size_t i = 0; i != partitionCount; ++i) {
+        partitions.emplace_back();
+        if(!partitions.back()) {
+            Error() << "MeshTools::Streaming::removeDuplicates(): can't create temporary file";
+            return false;
+        }
+    }
+
+    /* Distribute the positions into partitions by hash. Duplicates always
+       end up in the same partition. */
+    {
+        std::vector<std::vector<PositionEntry>> buffers(partitionCount);
+        const std::size_t bufferSize = std::min(chunkSize<PositionEntry>(memoryLimit/4/std::max(partitionCount, std::size_t(1))), std::size_t(4096));
+        std::vector<std::size_t> partitionSizes(partitionCount);
+        std::vector<Vector3> chunk(std::min(chunkSize<Vector3>(memoryLimit/4), vertexCount));
+        for(std::size_t offset = 0; offset < vertexCount; offset += chunk.size()) {
+            const std::size_t size = std::min(chunk.size(), vertexCount - offset);
+            if(!read(positions, chunk.data(), size)) {
+                Error() << "MeshTools::Streaming::removeDuplicates(): can't read positions";
+                return false;
+            }
+
+            for(std::size_t i = 0; i != size; ++i) {
+                UnsignedInt bits[3];
+                std::memcpy(bits, chunk[i].data(), sizeof(bits));
+                const std::size_t partition = Implementation::mix((UnsignedLong(bits[0]) | (UnsignedLong(bits[1]) << 32)) ^ (UnsignedLong(bits[2])*0x9e3779b97f4a7c15ull)) % partitionCount;
+
+                std::vector<PositionEntry>& buffer = buffers[partition];
+                buffer.push_back({chunk[i], UnsignedInt(offset + i)});
+                if(buffer.size() == bufferSize) {
+                    if(std::fwrite(buffer.data(), sizeof(PositionEntry), buffer.size(), *partitions[partition]) != buffer.size()) {
+                        Error() << "MeshTools::Streaming::removeDuplicates(): can't write temporary file";
+                        return false;
+                    }
+                    partitionSizes[partition] += buffer.size();
+                    buffer.clear();
+                }
+            }
+        }
+
+        for(std::size_t i = 0; i != partitionCount; ++i) {
+            if(std::fwrite(buffers[i].data(), sizeof(PositionEntry), buffers[i].size(), *partitions[i]) != buffers[i].size()) {
+                Error() << "MeshTools::Streaming::removeDuplicates(): can't write temporary file";
+                return false;
+            }
+            partitionSizes[i] += buffers[i].size();
+        }
+
+        /* Deduplicate each partition, write unique positions and remember
+           new index of each original vertex. Partitions are sorted in runs
+           fitting into the memory limit. A partition larger than that (many
+           duplicates of the same position, which always hash to the same
+           partition) has its sorted runs written back and then merged. */
+        PagedArray<UnsignedInt> remap{vertexCount, memoryLimit/4};
+        if(vertexCount && !remap) {
+            Error() << "MeshTools::Streaming::removeDuplicates(): can't create temporary file";
+            return false;
+        }
+        std::vector<PositionEntry> entries;
+        for(std::size_t i = 0; i != partitionCount; ++i) {
+            std::FILE* const file = *partitions[i];
+            const std::size_t runCount = (partitionSizes[i] + partitionSize - 1)/partitionSize;
+            auto runSize = [&](const std::size_t run) {
+                return std::min(partitionSize, partitionSizes[i] - run*partitionSize);
+            };
+
+            Vector3 previous;
+            bool hasPrevious = false;
+            auto emit = [&](const PositionEntry& entry) {
+                if(!hasPrevious || std::memcmp(entry.position.data(), previous.data(), sizeof(Vector3)) != 0) {
+                    if(!write(outPositions, &entry.position, 1)) return false;
+                    previous = entry.position;
+                    hasPrevious = true;
+                    ++outVertexCount;
+                }
+                remap.at(entry.index) = UnsignedInt(outVertexCount - 1);
+                return true;
+            };
+
+            for(std::size_t run = 0; run != runCount; ++run) {
+                const UnsignedLong runOffset = UnsignedLong(run)*partitionSize*sizeof(PositionEntry);
+                entries.resize(runSize(run));
+                if(!seek(file, runOffset) || std::fread(entries.data(), sizeof(PositionEntry), entries.size(), file) != entries.size()) {
+                    Error() << "MeshTools::Streaming::removeDuplicates(): can't read temporary file";
+                    return false;
+                }
+
+                std::sort(entries.begin(), entries.end(), lessPositionEntry);
+
+                if(runCount == 1) {
+                    for(const PositionEntry& entry: entries) if(!emit(entry)) {
+                        Error() << "MeshTools::Streaming::removeDuplicates(): can't write positions";
+                        return false;
+                    }
+                } else if(!seek(file, runOffset) || std::fwrite(entries.data(), sizeof(PositionEntry), entries.size(), file) != entries.size()) {
+                    Error() << "MeshTools::Streaming::removeDuplicates(): can't write temporary file";
+                    return false;
+                }
+            }
+            if(runCount <= 1) continue;
+
+            /* Merge the runs, the read buffers together take the same memory
+               as one run */
+            entries = std::vector<PositionEntry>{};
+            const std::size_t bufferSize = std::max(partitionSize/runCount, std::size_t(1));
+            std::vector<std::vector<PositionEntry>> buffers(runCount);
+            std::vector<std::size_t> consumed(runCount), cursors(runCount);
+            auto refill = [&](const std::size_t run) {
+                std::vector<PositionEntry>& buffer = buffers[run];
+                buffer.resize(std::min(bufferSize, runSize(run) - consumed[run]));
+                if(!seek(file, (UnsignedLong(run)*partitionSize + consumed[run])*sizeof(PositionEntry)) || std::fread(buffer.data(), sizeof(PositionEntry), buffer.size(), file) != buffer.size())
+                    return false;
+                consumed[run] += buffer.size();
+                cursors[run] = 0;
+                return true;
+            };
+            auto greater = [&](const std::size_t a, const std::size_t b) {
+                return lessPositionEntry(buffers[b][cursors[b]], buffers[a][cursors[a]]);
+            };
+
+            std::vector<std::size_t> heap;
+            heap.reserve(runCount);
+            for(std::size_t run = 0; run != runCount; ++run) {
+                if(!refill(run)) {
+                    Error() << "MeshTools::Streaming::removeDuplicates(): can't read temporary file";
+                    return false;
+                }
+                heap.push_back(run);
+            }
+            std::make_heap(heap.begin(), heap.end(), greater);
+
+            while(!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), greater);
+                const std::size_t run = heap.back();
+                if(!emit(buffers[run][cursors[run]])) {
+                    Error() << "MeshTools::Streaming::removeDuplicates(): can't write positions";
+                    return false;
+                }
+
+                if(++cursors[run] == buffers[run].size()) {
+                    if(consumed[run] == runSize(run)) {
+                        heap.pop_back();
+                        continue;
+                    }
+                    if(!refill(run)) {
+                        Error() << "MeshTools::Streaming::removeDuplicates(): can't read temporary file";
+                        return false;
+                    }
+                }
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+        }
+        entries = std::vector<PositionEntry>{};
+
+        /* Remap the indices */
+        std::vector<UnsignedInt> chunkIndices(std::min(chunkSize<UnsignedInt>(memoryLimit/4), indexCount));
+        for(std::size_t offset = 0; offset < indexCount; offset += chunkIndices.size()) {
+            const std::size_t size = std::min(chunkIndices.size(), indexCount - offset);
+            if(!read(indices, chunkIndices.data(), size)) {
+                Error() << "MeshTools::Streaming::removeDuplicates(): can't read indices";
+                return false;
+            }
+
+            for(std::size_t i = 0; i != size; ++i) {
+                if(chunkIndices[i] >= vertexCount) {
+                    Error() << "MeshTools::Streaming::removeDuplicates(): index out of range";
+                    return false;
+                }
+                chunkIndices[i] = remap.get(chunkIndices[i]);
+            }
+            if(!remap) {
+                Error() << "MeshTools::Streaming::removeDuplicates(): can't access temporary file";
+                return false;
+            }
+            if(!write(outIndices, chunkIndices.data(), size)) {
+                Error() << "MeshTools::Streaming::removeDuplicates(): can't write indices";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool generateSmoothNormals(std::istream& indices, const std::size_t indexCount, std::istream& positions, const std::size_t vertexCount, std::ostream& normals, const NormalWeighting weighting, const std::size_t memoryLimit) {
+    if(indexCount % 3) {
+        Error() << "MeshTools::Streaming::generateSmoothNormals(): index count is not divisible by 3";
+        return false;
+    }
+
+    PagedArray<Vector3> positionArray{vertexCount, memoryLimit/3};
+    PagedArray<Vector3> normalArray{vertexCount, memoryLimit/3};
+    if(vertexCount && (!positionArray || !normalArray)) {
+        Error() << "MeshTools::Streaming::generateSmoothNormals(): can't create temporary file";
+        return false;
+    }
+    if(!copy(positions, positionArray, vertexCount, memoryLimit/6)) {
+        Error() << "MeshTools::Streaming::generateSmoothNormals(): can't read positions";
+        return false;
+    }
+
+    /* Accumulate weighted face normals */
+    std::vector<UnsignedInt> chunk(std::min(chunkSize<UnsignedInt>(memoryLimit/6, 3), indexCount));
+    for(std::size_t offset = 0; offset < indexCount; offset += chunk.size()) {
+        const std::size_t size = std::min(chunk.size(), indexCount - offset);
+        if(!read(indices, chunk.data(), size)) {
+            Error() << "MeshTools::Streaming::generateSmoothNormals(): can't read indices";
+            return false;
+        }
+
+        for(std::size_t i = 0; i != size; i += 3) {
+            const UnsignedInt a = chunk[i], b = chunk[i + 1], c = chunk[i + 2];
+            if(a >= vertexCount || b >= vertexCount || c >= vertexCount) {
+                Error() << "MeshTools::Streaming::generateSmoothNormals(): index out of range";
+                return false;
+            }
+
+            Vector3 contributions[3];
+            Implementation::smoothNormalContributions(positionArray.get(a), positionArray.get(b), positionArray.get(c), weighting, contributions);
+            normalArray.at(a) += contributions[0];
+            normalArray.at(b) += contributions[1];
+            normalArray.at(c) += contributions[2];
+        }
+    }
+    if(!positionArray || !normalArray) {
+        Error() << "MeshTools::Streaming::generateSmoothNormals(): can't access temporary file";
+        return false;
+    }
+
+    /* Normalize and write out, leave zero normals as they are */
+    std::vector<Vector3> out(std::min(chunkSize<Vector3>(memoryLimit/6), vertexCount));
+    for(std::size_t offset = 0; offset < vertexCount; offset += out.size()) {
+        const std::size_t size = std::min(out.size(), vertexCount - offset);
+        for(std::size_t i = 0; i != size; ++i) {
+            const Vector3 normal = normalArray.get(offset + i);
+            const Float length = normal.length();
+            out[i] = length == 0.0f ? normal : normal/length;
+        }
+        if(!normalArray) {
+            Error() << "MeshTools::Streaming::generateSmoothNormals(): can't access temporary file";
+            return false;
+        }
+        if(!write(normals, out.data(), size)) {
+            Error() << "MeshTools::Streaming::generateSmoothNormals(): can't write normals";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool encodeIndices(std::istream& indices, const std::size_t indexCount, std::ostream& out, const std::size_t memoryLimit) {
+    if(indexCount % 3) {
+        Error() << "MeshTools::Streaming::encodeIndices(): index count is not divisible by 3";
+        return false;
+    }
+
+    /* Encoded triangle can be larger than the input in the worst case, size
+       the chunk so the chunk together with its worst-case encoded data takes
+       at most half of the limit, leaving the rest for the encoder state */
+    std::vector<UnsignedInt> chunk;
+    const std::size_t maxChunkSize = std::min(std::max(memoryLimit/2/(3*sizeof(UnsignedInt) + MaxEncodedTriangleSize), std::size_t(1))*3, indexCount);
+    for(std::size_t offset = 0; offset < indexCount; offset += maxChunkSize) {
+        chunk.resize(std::min(maxChunkSize, indexCount - offset));
+        if(!read(indices, chunk.data(), chunk.size())) {
+            Error() << "MeshTools::Streaming::encodeIndices(): can't read indices";
+            return false;
+        }
+
+        const Containers::Array<char> encoded = MeshTools::encodeIndices(chunk);
+        const UnsignedInt size = encoded.size();
+        if(!write(out, &size, 1) || !write(out, encoded.begin(), encoded.size())) {
+            Error() << "MeshTools::Streaming::encodeIndices(): can't write output";
+            return false;
+        }
+    }
+
+    const UnsignedInt end = 0;
+    if(!write(out, &end, 1)) {
+        Error() << "MeshTools::Streaming::encodeIndices(): can't write output";
+        return false;
+    }
+    return true;
+}
+
+bool decodeIndices(std::istream& in, std::ostream& indices, std::size_t& indexCount) {
+    indexCount = 0;
+
+    for(;;) {
+        UnsignedInt size;
+        if(!read(in, &size, 1)) {
+            Error() << "MeshTools::Streaming::decodeIndices(): can't read chunk size";
+            return false;
+        }
+        if(!size) return true;
+
+        /* The size comes from the stream, so don't trust it for allocation.
+           Reject it if larger than what's left in a seekable stream and
+           otherwise grow the buffer only by what was actually read. */
+        if(size > remaining(in)) {
+            Error() << "MeshTools::Streaming::decodeIndices(): can't read chunk data";
+            return false;
+        }
+        std::vector<char> encoded;
+        while(encoded.size() != size) {
+            const std::size_t offset = encoded.size();
+            encoded.resize(offset + std::min(std::size_t(PageSize), size - offset));
+            if(!read(in, encoded.data() + offset, encoded.size() - offset)) {
+                Error() << "MeshTools::Streaming::decodeIndices(): can't read chunk data";
+                return false;
+            }
+        }
+
+        std::size_t count;
+        Mesh::IndexType type;
+        Containers::Array<char> data;
+        std::tie(count, type, data) = MeshTools::decodeIndices({encoded.data(), encoded.size()});
+        if(!count) {
+            Error() << "MeshTools::Streaming::decodeIndices(): invalid chunk";
+            return false;
+        }
+
+        /* Expand to 32 bits */
+        bool written;
+        if(type == Mesh::IndexType::UnsignedInt)
+            written = write(indices, data.begin(), data.size());
+        else {
+            std::vector<UnsignedInt> expanded(count);
+            for(std::size_t i = 0; i != count; ++i)
+                expanded[i] = type == Mesh::IndexType::UnsignedByte ?
+                    reinterpret_cast<const UnsignedByte*>(data.begin())[i] :
+                    reinterpret_cast<const UnsignedShort*>(data.begin())[i];
+            written = write(indices, expanded.data(), count);
+        }
+        if(!written) {
+            Error() << "MeshTools::Streaming::decodeIndices(): can't write indices";
+            return false;
+        }
+
+        indexCount += count;
+    }
+}
+
+bool buildMeshlets(std::istream& indices, const std::size_t indexCount, std::istream& positions, const std::size_t vertexCount, std::ostream& meshlets, std::ostream& meshletVertices, std::ostream& meshletTriangles, std::ostream& chunks, std::size_t& meshletCount, std::size_t& chunkCount, const UnsignedInt maxVertices, const UnsignedInt maxTriangles, const std::size_t memoryLimit) {
+    meshletCount = 0;
+    chunkCount = 0;
+
+    if(indexCount % 3) {
+        Error() << "MeshTools::Streaming::buildMeshlets(): index count is not divisible by 3";
+        return false;
+    }
+
+    PagedArray<Vector3> positionArray{vertexCount, memoryLimit/2};
+    if(vertexCount && !positionArray) {
+        Error() << "MeshTools::Streaming::buildMeshlets(): can't create temporary file";
+        return false;
+    }
+    if(!copy(positions, positionArray, vertexCount, memoryLimit/4)) {
+        Error() << "MeshTools::Streaming::buildMeshlets(): can't read positions";
+        return false;
+    }
+
+    /* Index chunk together with local copies of indices, positions and the
+       output takes roughly eight times the size of the index chunk */
+    std::vector<UnsignedInt> chunk(std::min(chunkSize<UnsignedInt>(memoryLimit/16, 3), indexCount));
+    std::vector<UnsignedInt> localToGlobal;
+    std::vector<Vector3> localPositions;
+    std::unordered_map<UnsignedInt, UnsignedInt> globalToLocal;
+    MeshletChunk base{0, 0, 0};
+    for(std::size_t offset = 0; offset < indexCount; offset += chunk.size()) {
+        const std::size_t size = std::min(chunk.size(), indexCount - offset);
+        if(!read(indices, chunk.data(), size)) {
+            Error() << "MeshTools::Streaming::buildMeshlets(): can't read indices";
+            return false;
+        }
+
+        /* Make the indices local to the chunk */
+        std::vector<UnsignedInt> localIndices(size);
+        localToGlobal.clear();
+        localPositions.clear();
+        globalToLocal.clear();
+        for(std::size_t i = 0; i != size; ++i) {
+            if(chunk[i] >= vertexCount) {
+                Error() << "MeshTools::Streaming::buildMeshlets(): index out of range";
+                return false;
+            }
+
+            #ifndef CORRADE_GCC46_COMPATIBILITY
+            const auto result = globalToLocal.emplace(chunk[i], localToGlobal.size());
+            #else
+            const auto result = globalToLocal.insert({chunk[i], UnsignedInt(localToGlobal.size())});
+            #endif
+            if(result.second) {
+                localToGlobal.push_back(chunk[i]);
+                localPositions.push_back(positionArray.get(chunk[i]));
+            }
+            localIndices[i] = result.first->second;
+        }
+        if(!positionArray) {
+            Error() << "MeshTools::Streaming::buildMeshlets(): can't access temporary file";
+            return false;
+        }
+
+        std::vector<Meshlet> chunkMeshlets;
+        std::vector<UnsignedInt> chunkVertices;
+        std::vector<UnsignedByte> chunkTriangles;
+        std::tie(chunkMeshlets, chunkVertices, chunkTriangles) = MeshTools::buildMeshlets(localIndices, localPositions, maxVertices, maxTriangles);
+
+        /* Convert back to global vertex indices, meshlet offsets stay
+           relative to the chunk as the total size can exceed 32 bits */
+        for(UnsignedInt& vertex: chunkVertices) vertex = localToGlobal[vertex];
+
+        if(!write(chunks, &base, 1) ||
+           !write(meshlets, chunkMeshlets.data(), chunkMeshlets.size()) ||
+           !write(meshletVertices, chunkVertices.data(), chunkVertices.size()) ||
+           !write(meshletTriangles, chunkTriangles.data(), chunkTriangles.size())) {
+            Error() << "MeshTools::Streaming::buildMeshlets(): can't write output";
+            return false;
+        }
+        ++chunkCount;
+        base.meshletOffset += chunkMeshlets.size();
+        base.vertexOffset += chunkVertices.size();
+        base.triangleOffset += chunkTriangles.size();
+    }
+    meshletCount = base.meshletOffset;
+
+    return true;
+}
+
+}}}
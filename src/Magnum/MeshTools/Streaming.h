@@ -0,0 +1,168 @@
+#ifndef Magnum_MeshTools_Streaming_h
+#define Magnum_MeshTools_Streaming_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::MeshTools::Streaming
+ */
+
+#include <iosfwd>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Out-of-core variants of mesh processing functions
+
+Variants of @ref removeDuplicates(), @ref generateSmoothNormals(),
+@ref encodeIndices() and @ref buildMeshlets() for meshes which don't fit
+into memory. The data are consumed from and produced into binary streams
+(e.g. `std::ifstream` and `std::ofstream` opened in binary mode) with the
+same memory layout as the corresponding `std::vector`. Data needing random
+access are kept in temporary files with bounded amount of pages cached in
+memory, the @p memoryLimit parameter of each function specifies the upper
+bound for the size of all buffers together. Access with good locality (e.g.
+meshes optimized with @ref tipsify()) performs best.
+
+On error (e.g. truncated input, failure to create, read or write temporary
+file or failure to write the output) the functions print message to error
+output and return `false`. The output is incomplete in that case.
+*/
+namespace Streaming {
+
+/**
+@brief Remove duplicate vertices
+@param[in] positions        Vertex positions
+@param[in] vertexCount      Vertex count
+@param[in] indices          Vertex indices
+@param[in] indexCount       Index count
+@param[out] outPositions    Unique vertex positions
+@param[out] outIndices      Indices referencing @p outPositions
+@param[out] outVertexCount  Unique vertex count
+@param[in] memoryLimit      Memory limit in bytes
+
+Unlike @ref MeshTools::removeDuplicates() only bitwise equal positions are
+merged. The positions are partitioned into temporary files by hash so each
+partition fits into the memory, deduplicated there and then the indices are
+remapped. The unique vertices are ordered by partition, not by first
+occurrence.
+*/
+bool MAGNUM_MESHTOOLS_EXPORT removeDuplicates(std::istream& positions, std::size_t vertexCount, std::istream& indices, std::size_t indexCount, std::ostream& outPositions, std::ostream& outIndices, std::size_t& outVertexCount, std::size_t memoryLimit = 256*1024*1024);
+
+/**
+@brief Generate smooth normals
+@param[in] indices          Triangle vertex indices
+@param[in] indexCount       Index count
+@param[in] positions        Vertex positions
+@param[in] vertexCount      Vertex count
+@param[out] normals         One normal for each position
+@param[in] weighting        Face normal weighting
+@param[in] memoryLimit      Memory limit in bytes
+
+Equivalent to @ref MeshTools::generateSmoothNormals(). The positions and the
+accumulated normals are kept in temporary files, the indices are processed
+sequentially.
+*/
+bool MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(std::istream& indices, std::size_t indexCount, std::istream& positions, std::size_t vertexCount, std::ostream& normals, NormalWeighting weighting = NormalWeighting::Angle, std::size_t memoryLimit = 256*1024*1024);
+
+/**
+@brief Encode triangle indices
+@param[in] indices          Triangle vertex indices
+@param[in] indexCount       Index count
+@param[out] out             Encoded data
+@param[in] memoryLimit      Memory limit in bytes
+
+The indices are split into chunks fitting into the memory and each of them is
+encoded using @ref MeshTools::encodeIndices(). The output contains the
+encoded size and data of each chunk, terminated by zero size. Use
+@ref decodeIndices() to decode it.
+*/
+bool MAGNUM_MESHTOOLS_EXPORT encodeIndices(std::istream& indices, std::size_t indexCount, std::ostream& out, std::size_t memoryLimit = 256*1024*1024);
+
+/**
+@brief Decode triangle indices
+@param[in] in               Data encoded with @ref encodeIndices()
+@param[out] indices         Decoded indices as @ref Magnum::UnsignedInt "UnsignedInt"
+@param[out] indexCount      Decoded index count
+
+The chunks are decoded one after another, memory use is bounded by the chunk
+size used during encoding.
+*/
+bool MAGNUM_MESHTOOLS_EXPORT decodeIndices(std::istream& in, std::ostream& indices, std::size_t& indexCount);
+
+/**
+@brief Meshlet chunk
+
+Base offsets of one chunk produced by @ref buildMeshlets(). Offsets in the
+@ref Meshlet structures are relative to the chunk they belong to, as the
+whole output can have more than 2^32 items.
+*/
+struct MeshletChunk {
+    /** @brief Offset of first meshlet of the chunk in the meshlet array */
+    UnsignedLong meshletOffset;
+
+    /** @brief Base for @ref Meshlet::vertexOffset of meshlets in the chunk */
+    UnsignedLong vertexOffset;
+
+    /** @brief Base for @ref Meshlet::triangleOffset of meshlets in the chunk */
+    UnsignedLong triangleOffset;
+};
+
+/**
+@brief Partition the mesh into meshlets
+@param[in] indices              Triangle vertex indices
+@param[in] indexCount           Index count
+@param[in] positions            Vertex positions
+@param[in] vertexCount          Vertex count
+@param[out] meshlets            Array of @ref Meshlet structures
+@param[out] meshletVertices     Vertex indices referenced by the meshlets
+@param[out] meshletTriangles    Local triangle indices
+@param[out] chunks              Array of @ref MeshletChunk structures
+@param[out] meshletCount        Meshlet count
+@param[out] chunkCount          Chunk count
+@param[in] maxVertices          Max vertex count in a meshlet
+@param[in] maxTriangles         Max triangle count in a meshlet
+@param[in] memoryLimit          Memory limit in bytes
+
+The triangles are processed in chunks using @ref MeshTools::buildMeshlets(),
+meshlets thus don't span chunk boundaries. The output streams have the same
+layout as the arrays returned from @ref MeshTools::buildMeshlets(), but the
+offsets in the meshlets are relative to the chunk. Meshlets of chunk `i` are
+the ones from `chunks[i].meshletOffset` to `chunks[i + 1].meshletOffset`
+(or @p meshletCount for the last chunk), their vertices start at
+`chunks[i].vertexOffset + meshlet.vertexOffset` and their triangles at
+`chunks[i].triangleOffset + meshlet.triangleOffset`.
+*/
+bool MAGNUM_MESHTOOLS_EXPORT buildMeshlets(std::istream& indices, std::size_t indexCount, std::istream& positions, std::size_t vertexCount, std::ostream& meshlets, std::ostream& meshletVertices, std::ostream& meshletTriangles, std::ostream& chunks, std::size_t& meshletCount, std::size_t& chunkCount, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 126, std::size_t memoryLimit = 256*1024*1024);
+
+}
+
+}}
+
+#endif
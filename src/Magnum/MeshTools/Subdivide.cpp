@@ -0,0 +1,127 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Subdivide.h"
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+struct Edge {
+    UnsignedInt a, b;
+    UnsignedInt vertex; /* New vertex in the middle */
+    UnsignedInt faceCount;
+    UnsignedInt opposite[2];
+};
+
+}
+
+void subdivideLoop(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideLoop(): index count is not divisible by 3!", );
+
+    const std::size_t indexCount = indices.size();
+    const std::size_t vertexCount = positions.size();
+
+    /* Collect edges with their opposite vertices and assign new vertices to
+       them */
+    std::vector<Edge> edges;
+    edges.reserve(indexCount);
+    std::unordered_map<UnsignedLong, UnsignedInt> edgeIds(indexCount);
+    std::vector<UnsignedInt> faceEdges(indexCount);
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = indices[i+j], b = indices[i+(j+1)%3];
+            CORRADE_ASSERT(a < vertexCount && b < vertexCount, "MeshTools::subdivideLoop(): index out of range", );
+
+            #ifndef CORRADE_GCC46_COMPATIBILITY
+            const auto result = edgeIds.emplace(Implementation::edgeKey(a, b), edges.size());
+            #else
+            const auto result = edgeIds.insert({Implementation::edgeKey(a, b), UnsignedInt(edges.size())});
+            #endif
+            if(result.second) edges.push_back(Edge{a, b, UnsignedInt(vertexCount + edges.size()), 0, {}});
+
+            Edge& edge = edges[result.first->second];
+            if(edge.faceCount < 2) edge.opposite[edge.faceCount] = indices[i+(j+2)%3];
+            ++edge.faceCount;
+            faceEdges[i+j] = result.first->second;
+        }
+    }
+
+    /* Sum of neighbors for each original vertex, separately for neighbors on
+       boundary edges */
+    std::vector<Vector3> neighborSums(vertexCount);
+    std::vector<UnsignedInt> neighborCounts(vertexCount);
+    std::vector<Vector3> boundarySums(vertexCount);
+    std::vector<UnsignedInt> boundaryCounts(vertexCount);
+    for(const Edge& edge: edges) {
+        const UnsignedInt a = edge.a, b = edge.b;
+        if(edge.faceCount == 2) {
+            neighborSums[a] += positions[b];
+            neighborSums[b] += positions[a];
+            ++neighborCounts[a];
+            ++neighborCounts[b];
+        } else {
+            boundarySums[a] += positions[b];
+            boundarySums[b] += positions[a];
+            ++boundaryCounts[a];
+            ++boundaryCounts[b];
+        }
+    }
+
+    /* Edge vertices, calculated from original positions */
+    positions.resize(vertexCount + edges.size());
+    for(const Edge& edge: edges) {
+        const UnsignedInt a = edge.a, b = edge.b;
+        positions[edge.vertex] = edge.faceCount == 2 ?
+            (positions[a] + positions[b])*(3.0f/8.0f) + (positions[edge.opposite[0]] + positions[edge.opposite[1]])*(1.0f/8.0f) :
+            (positions[a] + positions[b])*0.5f;
+    }
+
+    /* Smooth the original vertices. Interior vertices use Warren's weights,
+       regular boundary vertices are smoothed along the boundary curve and
+       corners with other than two boundary edges stay in place. */
+    for(std::size_t i = 0; i != vertexCount; ++i) {
+        if(boundaryCounts[i] == 2)
+            positions[i] = positions[i]*(3.0f/4.0f) + boundarySums[i]*(1.0f/8.0f);
+        else if(boundaryCounts[i] == 0 && neighborCounts[i] != 0) {
+            const UnsignedInt n = neighborCounts[i];
+            const Float beta = n == 3 ? 3.0f/16.0f : 3.0f/(8.0f*n);
+            positions[i] = positions[i]*(1.0f - n*beta) + neighborSums[i]*beta;
+        }
+    }
+
+    /* Subdivide the faces */
+    indices.reserve(indexCount*4);
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        const UnsignedInt newVertices[]{edges[faceEdges[i]].vertex,
+                                        edges[faceEdges[i+1]].vertex,
+                                        edges[faceEdges[i+2]].vertex};
+        Implementation::subdivideFace(indices, i, newVertices);
+    }
+}
+
+}}
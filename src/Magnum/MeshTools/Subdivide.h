@@ -26,12 +26,17 @@
 */
 
 /** @file
- * @brief Function Magnum::MeshTools::subdivide()
+ * @brief Function @ref Magnum::MeshTools::subdivide(), @ref Magnum::MeshTools::subdivideShared(), @ref Magnum::MeshTools::subdivideLoop()
  */
 
+#include <unordered_map>
 #include <vector>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
@@ -50,14 +55,35 @@ template<class Vertex, class Interpolator> class Subdivide {
             vertices.push_back(v);
             return vertices.size()-1;
         }
-
-        void addFace(UnsignedInt first, UnsignedInt second, UnsignedInt third) {
-            indices.push_back(first);
-            indices.push_back(second);
-            indices.push_back(third);
-        }
 };
 
+/* Key for edge hash, independent on edge direction */
+inline UnsignedLong edgeKey(const UnsignedInt a, const UnsignedInt b) {
+    return a < b ? (UnsignedLong(a) << 32)|b : (UnsignedLong(b) << 32)|a;
+}
+
+/* Writes the subdivided faces, face `i` is replaced with the middle one */
+inline void subdivideFace(std::vector<UnsignedInt>& indices, const std::size_t i, const UnsignedInt(&newVertices)[3]) {
+    /*
+        * Add three new faces (0, 1, 3) and update original (2)
+        *
+        *                orig 0
+        *                /   \
+        *               /  0  \
+        *              /       \
+        *          new 0 ----- new 2
+        *          /   \       /  \
+        *         /  1  \  2  / 3  \
+        *        /       \   /      \
+        *   orig 1 ----- new 1 ---- orig 2
+        */
+    indices.insert(indices.end(), {indices[i], newVertices[0], newVertices[2],
+                                   newVertices[0], indices[i+1], newVertices[1],
+                                   newVertices[2], newVertices[1], indices[i+2]});
+    for(std::size_t j = 0; j != 3; ++j)
+        indices[i+j] = newVertices[j];
+}
+
 }
 
 /**
@@ -71,11 +97,80 @@ template<class Vertex, class Interpolator> class Subdivide {
 
 Goes through all triangle faces and subdivides them into four new. Removing
 duplicate vertices in the mesh is up to user.
+@see @ref subdivideShared(), @ref subdivideLoop()
 */
 template<class Vertex, class Interpolator> inline void subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
     Implementation::Subdivide<Vertex, Interpolator>(indices, vertices)(interpolator);
 }
 
+/**
+@brief %Subdivide the mesh, sharing vertices on common edges
+@tparam Vertex          Vertex data type
+@tparam Interpolator    See `interpolator` function parameter
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param interpolator     Functor or function pointer which interpolates
+    two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
+
+Same as @ref subdivide(), but the new vertices are tracked per edge, so
+faces sharing an edge share also the new vertex in its middle. If the input
+mesh has no duplicate vertices, the output mesh doesn't have them either and
+thus there's no need to call @ref removeDuplicates() after each iteration.
+The face layout in @p indices is the same as with @ref subdivide().
+*/
+template<class Vertex, class Interpolator> void subdivideShared(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideShared(): index count is not divisible by 3!", );
+
+    const std::size_t indexCount = indices.size();
+    indices.reserve(indices.size()*4);
+
+    /* Each edge is shared by two faces in closed mesh, reserving for the
+       worst case */
+    vertices.reserve(vertices.size() + indexCount);
+    std::unordered_map<UnsignedLong, UnsignedInt> edges(indexCount);
+
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        UnsignedInt newVertices[3];
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = indices[i+j], b = indices[i+(j+1)%3];
+
+            /* Interpolate the edge only if it wasn't there already */
+            #ifndef CORRADE_GCC46_COMPATIBILITY
+            const auto result = edges.emplace(Implementation::edgeKey(a, b), vertices.size());
+            #else
+            const auto result = edges.insert({Implementation::edgeKey(a, b), UnsignedInt(vertices.size())});
+            #endif
+            if(result.second) vertices.push_back(interpolator(vertices[a], vertices[b]));
+            newVertices[j] = result.first->second;
+        }
+
+        Implementation::subdivideFace(indices, i, newVertices);
+    }
+}
+
+/**
+@brief %Subdivide the mesh using Loop subdivision
+@param[in,out] indices      Index array to operate on
+@param[in,out] positions    Vertex positions to operate on
+
+Unlike @ref subdivideShared(), which just interpolates the edges, this
+function uses weights of Loop subdivision scheme: new edge vertices are
+weighted averages of the edge endpoints and of the two opposite vertices and
+the original vertices are smoothed with their neighbors. Edges used by other
+than two faces are treated as boundary (crease) edges and are subdivided as
+curves. Vertices on such edges are smoothed only along them, other vertices
+keep their position. The original vertices keep their indices, the new ones
+are added to the end and the face layout in @p indices is the same as with
+@ref subdivide(). Algorithm used: *Charles Loop - Smooth Subdivision Surfaces
+Based on Triangles, M.S. Mathematics Thesis, University of Utah, 1987*.
+
+Other vertex attributes are not handled, as their meaning (e.g. texture
+seams) is not known to this function. The mesh is expected to have no
+duplicate vertices, otherwise faces which are neighbors in space aren't
+connected and the surface will have cracks.
+*/
+void MAGNUM_MESHTOOLS_EXPORT subdivideLoop(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions);
+
 namespace Implementation {
 
 template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>::operator()(Interpolator interpolator) {
@@ -91,24 +186,8 @@ template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>:
         for(int j = 0; j != 3; ++j)
             newVertices[j] = addVertex(interpolator(vertices[indices[i+j]], vertices[indices[i+(j+1)%3]]));
 
-        /*
-            * Add three new faces (0, 1, 3) and update original (2)
-            *
-            *                orig 0
-            *                /   \
-            *               /  0  \
-            *              /       \
-            *          new 0 ----- new 2
-            *          /   \       /  \
-            *         /  1  \  2  / 3  \
-            *        /       \   /      \
-            *   orig 1 ----- new 1 ---- orig 2
-            */
-        addFace(indices[i], newVertices[0], newVertices[2]);
-        addFace(newVertices[0], indices[i+1], newVertices[1]);
-        addFace(newVertices[2], newVertices[1], indices[i+2]);
-        for(std::size_t j = 0; j != 3; ++j)
-            indices[i+j] = newVertices[j];
+        /* Add three new faces and update original */
+        subdivideFace(indices, i, newVertices);
     }
 }
 
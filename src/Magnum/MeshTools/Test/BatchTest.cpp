@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Batch.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class BatchTest: public TestSuite::Tester {
+    public:
+        explicit BatchTest();
+
+        void indexed();
+        void mixedIndexed();
+        void nonIndexed();
+        void transformed();
+        void differentLayout();
+        void wrongTransformationCount();
+};
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::indexed,
+              &BatchTest::mixedIndexed,
+              &BatchTest::nonIndexed,
+              &BatchTest::transformed,
+              &BatchTest::differentLayout,
+              &BatchTest::wrongTransformationCount});
+}
+
+void BatchTest::indexed() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {0, 1, 2, 0, 2, 3},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {}, {{{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}}}};
+    const Trade::MeshData3D b{MeshPrimitive::Triangles, {2, 1, 0},
+        {{{5.0f, 0.0f, 0.0f}, {6.0f, 0.0f, 0.0f}, {6.0f, 1.0f, 0.0f}}},
+        {}, {{{0.5f, 0.0f}, {1.0f, 0.5f}, {0.0f, 0.5f}}}};
+
+    Trade::MeshData3D data{MeshPrimitive::Points, {}, {{}}, {}, {}};
+    std::vector<BatchRange> ranges;
+    std::tie(data, ranges) = MeshTools::batch({a, b, a});
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{
+        0, 1, 2, 0, 2, 3,
+        6, 5, 4,
+        7, 8, 9, 7, 9, 10}));
+    CORRADE_COMPARE(data.positions(0).size(), 11);
+    CORRADE_COMPARE(data.positions(0)[5], Vector3(6.0f, 0.0f, 0.0f));
+    CORRADE_VERIFY(!data.hasNormals());
+    CORRADE_VERIFY(data.hasTextureCoords2D());
+    CORRADE_COMPARE(data.textureCoords2D(0)[6], Vector2(0.0f, 0.5f));
+
+    CORRADE_COMPARE(ranges.size(), 3);
+    CORRADE_COMPARE(ranges[1].indexOffset, 6);
+    CORRADE_COMPARE(ranges[1].indexCount, 3);
+    CORRADE_COMPARE(ranges[1].vertexOffset, 4);
+    CORRADE_COMPARE(ranges[1].vertexCount, 3);
+    CORRADE_COMPARE(ranges[2].indexOffset, 9);
+    CORRADE_COMPARE(ranges[2].indexCount, 6);
+    CORRADE_COMPARE(ranges[2].vertexOffset, 7);
+    CORRADE_COMPARE(ranges[2].vertexCount, 4);
+}
+
+void BatchTest::mixedIndexed() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}}}, {}, {}};
+    const Trade::MeshData3D b{MeshPrimitive::Triangles, {0, 2, 1},
+        {{{5.0f, 0.0f, 0.0f}, {6.0f, 0.0f, 0.0f}, {6.0f, 1.0f, 0.0f}}}, {}, {}};
+
+    Trade::MeshData3D data{MeshPrimitive::Points, {}, {{}}, {}, {}};
+    std::vector<BatchRange> ranges;
+    std::tie(data, ranges) = MeshTools::batch({a, b});
+
+    /* Trivial indices are generated for the non-indexed mesh */
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4}));
+    CORRADE_COMPARE(ranges[0].indexCount, 3);
+    CORRADE_COMPARE(ranges[1].indexOffset, 3);
+}
+
+void BatchTest::nonIndexed() {
+    const Trade::MeshData3D a{MeshPrimitive::Lines, {},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}}, {}, {}};
+
+    Trade::MeshData3D data{MeshPrimitive::Points, {}, {{}}, {}, {}};
+    std::vector<BatchRange> ranges;
+    std::tie(data, ranges) = MeshTools::batch({a, a});
+
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.positions(0).size(), 4);
+    CORRADE_COMPARE(ranges[1].indexCount, 0);
+    CORRADE_COMPARE(ranges[1].vertexOffset, 2);
+    CORRADE_COMPARE(ranges[1].vertexCount, 2);
+}
+
+void BatchTest::transformed() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {0, 1, 2},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{Vector3::zAxis(), Vector3::zAxis(), Vector3(1.0f, 0.0f, 1.0f).normalized()}}, {}};
+
+    Trade::MeshData3D data{MeshPrimitive::Points, {}, {{}}, {}, {}};
+    std::vector<BatchRange> ranges;
+    std::tie(data, ranges) = MeshTools::batch({a, a}, {
+        Matrix4::translation(Vector3::xAxis(10.0f)),
+        Matrix4::scaling({2.0f, 1.0f, 1.0f})});
+
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector3>{
+        {10.0f, 0.0f, 0.0f}, {11.0f, 0.0f, 0.0f}, {10.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}));
+
+    /* Normals are transformed with inverse transpose and renormalized */
+    CORRADE_COMPARE(data.normals(0)[2], Vector3(1.0f, 0.0f, 1.0f).normalized());
+    CORRADE_COMPARE(data.normals(0)[3], Vector3::zAxis());
+    CORRADE_COMPARE(data.normals(0)[5], Vector3(0.5f, 0.0f, 1.0f).normalized());
+}
+
+void BatchTest::differentLayout() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {}, {}};
+    const Trade::MeshData3D b{MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {{{}, {}, {}}}, {}};
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    MeshTools::batch({a, b});
+    CORRADE_COMPARE(out.str(), "MeshTools::batch(): all meshes must have the same primitive and attributes\n");
+}
+
+void BatchTest::wrongTransformationCount() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {}, {}};
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    MeshTools::batch({a, a}, {Matrix4()});
+    CORRADE_COMPARE(out.str(), "MeshTools::batch(): expected 2 transformations but got 1\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BatchTest)
@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/Transform.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class BoundingVolumeTest: public TestSuite::Tester {
+    public:
+        explicit BoundingVolumeTest();
+
+        void empty();
+        void range();
+        void sphere();
+        void sphereSinglePoint();
+        void boxOriented();
+        void boxOrientedDegenerate();
+};
+
+BoundingVolumeTest::BoundingVolumeTest() {
+    addTests({&BoundingVolumeTest::empty,
+              &BoundingVolumeTest::range,
+              &BoundingVolumeTest::sphere,
+              &BoundingVolumeTest::sphereSinglePoint,
+              &BoundingVolumeTest::boxOriented,
+              &BoundingVolumeTest::boxOrientedDegenerate});
+}
+
+namespace {
+
+/* Corners of box with sizes 8, 2 and 4 centered at (1, 2, 3) */
+const std::vector<Vector3> box{
+    {-3.0f, 1.0f, 1.0f}, { 5.0f, 1.0f, 1.0f},
+    {-3.0f, 3.0f, 1.0f}, { 5.0f, 3.0f, 1.0f},
+    {-3.0f, 1.0f, 5.0f}, { 5.0f, 1.0f, 5.0f},
+    {-3.0f, 3.0f, 5.0f}, { 5.0f, 3.0f, 5.0f}
+};
+
+}
+
+void BoundingVolumeTest::empty() {
+    const Range3D range = MeshTools::boundingRange({});
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere({});
+    const Matrix4 box = MeshTools::boundingBoxOriented({});
+
+    CORRADE_COMPARE(range.min(), Vector3());
+    CORRADE_COMPARE(range.max(), Vector3());
+    CORRADE_COMPARE(sphere.first, Vector3());
+    CORRADE_COMPARE(sphere.second, 0.0f);
+    CORRADE_COMPARE(box, Matrix4(Matrix4::Zero));
+}
+
+void BoundingVolumeTest::range() {
+    const Range3D range = MeshTools::boundingRange(box);
+    CORRADE_COMPARE(range.min(), Vector3(-3.0f, 1.0f, 1.0f));
+    CORRADE_COMPARE(range.max(), Vector3(5.0f, 3.0f, 5.0f));
+}
+
+void BoundingVolumeTest::sphere() {
+    /* Circumscribed sphere of the box is the minimal one */
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere(box);
+    CORRADE_COMPARE(sphere.first, Vector3(1.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(sphere.second, std::sqrt(21.0f));
+
+    /* Points around a circle, with initial diameter not spanning the whole
+       set. The sphere must contain all points and be reasonably tight. */
+    std::vector<Vector3> points;
+    for(Int i = 0; i != 37; ++i) {
+        const Rad angle(Float(i)*2.0f*Constants::pi()/37.0f);
+        points.push_back(Vector3(Math::cos(angle), Math::sin(angle)*0.5f, Math::sin(angle)*0.5f)*3.0f + Vector3(1.0f));
+    }
+    const std::pair<Vector3, Float> circle = MeshTools::boundingSphere(points);
+    for(const Vector3& point: points)
+        CORRADE_VERIFY((point - circle.first).length() <= circle.second + 1.0e-5f);
+    CORRADE_VERIFY(circle.second < 3.0f*1.05f);
+}
+
+void BoundingVolumeTest::sphereSinglePoint() {
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere({{1.0f, 2.0f, 3.0f}});
+    CORRADE_COMPARE(sphere.first, Vector3(1.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(sphere.second, 0.0f);
+}
+
+void BoundingVolumeTest::boxOriented() {
+    /* Rotated box, the OBB should have the original size and contain all
+       points */
+    const Matrix4 transformation = Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -1.0f).normalized());
+    const std::vector<Vector3> points = MeshTools::transformPoints(transformation, box);
+    const Matrix4 m = MeshTools::boundingBoxOriented(points);
+
+    CORRADE_COMPARE(m.translation(), transformation.transformPoint({1.0f, 2.0f, 3.0f}));
+
+    /* The axes are sorted by variance (i.e. size) and right-handed */
+    CORRADE_COMPARE(m[0].xyz().length(), 4.0f);
+    CORRADE_COMPARE(m[1].xyz().length(), 2.0f);
+    CORRADE_COMPARE(m[2].xyz().length(), 1.0f);
+    CORRADE_VERIFY(m.rotationScaling().determinant() > 0.0f);
+
+    /* All points are inside the unit box after inverse transformation */
+    const Matrix4 inverted = m.inverted();
+    for(const Vector3& point: points) {
+        const Vector3 local = inverted.transformPoint(point);
+        CORRADE_VERIFY((Math::abs(local) <= Vector3(1.0f + 1.0e-4f)).all());
+    }
+}
+
+void BoundingVolumeTest::boxOrientedDegenerate() {
+    /* Planar data, the box has zero size in one direction */
+    const Matrix4 m = MeshTools::boundingBoxOriented({
+        {0.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f}, {2.0f, 0.0f, 1.0f}});
+
+    CORRADE_COMPARE(m.translation(), Vector3(1.0f, 0.0f, 0.5f));
+    CORRADE_COMPARE(Math::abs(m[0].xyz()), Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(Math::abs(m[1].xyz()), Vector3(0.0f, 0.0f, 0.5f));
+    CORRADE_COMPARE(m[2].xyz(), Vector3());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BoundingVolumeTest)
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class BuildMeshletsTest: public TestSuite::Tester {
+    public:
+        BuildMeshletsTest();
+
+        void wrongIndexCount();
+        void vertexLimit();
+        void triangleLimit();
+        void boundsCone();
+};
+
+BuildMeshletsTest::BuildMeshletsTest() {
+    addTests({&BuildMeshletsTest::wrongIndexCount,
+              &BuildMeshletsTest::vertexLimit,
+              &BuildMeshletsTest::triangleLimit,
+              &BuildMeshletsTest::boundsCone});
+}
+
+namespace {
+
+/*
+    Strip of three quads facing +Z
+
+    4 -- 5 -- 6 -- 7
+    |  / |  / |  / |
+    0 -- 1 -- 2 -- 3
+*/
+const std::vector<Vector3> positions{
+    {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {2.0f, 1.0f, 0.0f}, {3.0f, 1.0f, 0.0f}
+};
+
+const std::vector<UnsignedInt> indices{
+    0, 1, 5, 0, 5, 4,
+    1, 2, 6, 1, 6, 5,
+    2, 3, 7, 2, 7, 6
+};
+
+}
+
+void BuildMeshletsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    std::vector<Meshlet> meshlets;
+    std::tie(meshlets, std::ignore, std::ignore) = MeshTools::buildMeshlets({0, 1}, positions);
+
+    CORRADE_VERIFY(meshlets.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::buildMeshlets(): index count is not divisible by 3!\n");
+}
+
+void BuildMeshletsTest::vertexLimit() {
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> triangles;
+    std::tie(meshlets, vertices, triangles) = MeshTools::buildMeshlets(indices, positions, 4);
+
+    /* One quad per meshlet */
+    CORRADE_COMPARE(meshlets.size(), 3);
+    CORRADE_COMPARE(vertices, (std::vector<UnsignedInt>{
+        0, 1, 5, 4,
+        1, 2, 6, 5,
+        2, 3, 7, 6
+    }));
+    CORRADE_COMPARE(triangles, (std::vector<UnsignedByte>{
+        0, 1, 2, 0, 2, 3,
+        0, 1, 2, 0, 2, 3,
+        0, 1, 2, 0, 2, 3
+    }));
+    for(std::size_t i = 0; i != meshlets.size(); ++i) {
+        CORRADE_COMPARE(meshlets[i].vertexOffset, i*4);
+        CORRADE_COMPARE(meshlets[i].vertexCount, 4);
+        CORRADE_COMPARE(meshlets[i].triangleOffset, i*6);
+        CORRADE_COMPARE(meshlets[i].triangleCount, 2);
+    }
+}
+
+void BuildMeshletsTest::triangleLimit() {
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::tie(meshlets, vertices, std::ignore) = MeshTools::buildMeshlets(indices, positions, 64, 4);
+
+    CORRADE_COMPARE(meshlets.size(), 2);
+    CORRADE_COMPARE(meshlets[0].triangleCount, 4);
+    CORRADE_COMPARE(meshlets[0].vertexCount, 6);
+    CORRADE_COMPARE(meshlets[1].triangleCount, 2);
+    CORRADE_COMPARE(meshlets[1].vertexCount, 4);
+    CORRADE_COMPARE(vertices.size(), 10);
+}
+
+void BuildMeshletsTest::boundsCone() {
+    std::vector<Meshlet> meshlets;
+    std::tie(meshlets, std::ignore, std::ignore) = MeshTools::buildMeshlets(indices, positions);
+
+    CORRADE_COMPARE(meshlets.size(), 1);
+    const Meshlet& meshlet = meshlets[0];
+    CORRADE_COMPARE(meshlet.center, (Vector3{1.5f, 0.5f, 0.0f}));
+    CORRADE_COMPARE(meshlet.radius, (Vector2{1.5f, 0.5f}).length());
+    CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+
+    CORRADE_VERIFY(MeshTools::isMeshletBackfacing(meshlet, {1.5f, 0.5f, -5.0f}));
+    CORRADE_VERIFY(!MeshTools::isMeshletBackfacing(meshlet, {1.5f, 0.5f, 5.0f}));
+    /* Grazing angle, some triangles might be visible */
+    CORRADE_VERIFY(!MeshTools::isMeshletBackfacing(meshlet, {-5.0f, 0.5f, -0.1f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BuildMeshletsTest)
@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/CleanMesh.h"
+#include "Magnum/MeshTools/Duplicate.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class CleanMeshTest: public TestSuite::Tester {
+    public:
+        explicit CleanMeshTest();
+
+        void wrongIndexCount();
+        void indexOutOfRange();
+        void clean();
+        void cleanEpsilon();
+};
+
+CleanMeshTest::CleanMeshTest() {
+    addTests({&CleanMeshTest::wrongIndexCount,
+              &CleanMeshTest::indexOutOfRange,
+              &CleanMeshTest::clean,
+              &CleanMeshTest::cleanEpsilon});
+}
+
+void CleanMeshTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<UnsignedInt> indices{0, 1};
+    std::vector<Vector3> positions(2);
+    MeshTools::cleanMesh(indices, positions);
+    CORRADE_COMPARE(out.str(), "MeshTools::cleanMesh(): index count is not divisible by 3\n");
+}
+
+void CleanMeshTest::indexOutOfRange() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    std::vector<Vector3> positions(2);
+    MeshTools::cleanMesh(indices, positions);
+    CORRADE_COMPARE(out.str(), "MeshTools::cleanMesh(): index out of range\n");
+}
+
+void CleanMeshTest::clean() {
+    std::vector<UnsignedInt> indices{
+        5, 1, 3,    /* kept */
+        1, 1, 2,    /* same index */
+        1, 3, 5,    /* rotated duplicate */
+        5, 3, 1,    /* opposite winding, kept */
+        0, 1, 4,    /* zero area, collinear */
+        5, 1, 3     /* exact duplicate */
+    };
+    std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {7.0f, 7.0f, 7.0f},
+        {1.0f, 1.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+    const std::vector<Vector3> original = positions;
+
+    const std::vector<UnsignedInt> mapping = MeshTools::cleanMesh(indices, positions);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2, 0, 2, 1}));
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{5, 1, 3}));
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(MeshTools::duplicate(mapping, original), positions);
+}
+
+void CleanMeshTest::cleanEpsilon() {
+    std::vector<UnsignedInt> indices{0, 1, 2, 0, 1, 3};
+    std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.001f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+
+    /* The first triangle has area 0.0005 */
+    MeshTools::cleanMesh(indices, positions, 0.001f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CleanMeshTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <functional>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
@@ -39,12 +40,18 @@ class CombineIndexedArraysTest: public TestSuite::Tester {
         void wrongIndexCount();
         void indexArrays();
         void indexedArrays();
+        void interleavedArrays();
+        void interleavedArraysGenericStride();
+        void interleavedArraysMany();
 };
 
 CombineIndexedArraysTest::CombineIndexedArraysTest() {
     addTests({&CombineIndexedArraysTest::wrongIndexCount,
               &CombineIndexedArraysTest::indexArrays,
-              &CombineIndexedArraysTest::indexedArrays});
+              &CombineIndexedArraysTest::indexedArrays,
+              &CombineIndexedArraysTest::interleavedArrays,
+              &CombineIndexedArraysTest::interleavedArraysGenericStride,
+              &CombineIndexedArraysTest::interleavedArraysMany});
 }
 
 void CombineIndexedArraysTest::wrongIndexCount() {
@@ -88,6 +95,50 @@ void CombineIndexedArraysTest::indexedArrays() {
     CORRADE_COMPARE(array3, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::interleavedArrays() {
+    /* Example from the documentation */
+    std::vector<UnsignedInt> result;
+    std::vector<UnsignedInt> interleaved;
+    std::tie(result, interleaved) = MeshTools::combineIndexArrays(
+        {0, 1, 2, 3, 5, 4, 0, 1, 0, 4, 1, 6, 3, 1, 2, 3, 2, 1}, 2);
+
+    CORRADE_COMPARE(result, (std::vector<UnsignedInt>{0, 1, 2, 0, 3, 4, 5, 1, 6}));
+    CORRADE_COMPARE(interleaved, (std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 4, 1, 6, 3, 1, 2, 1}));
+}
+
+void CombineIndexedArraysTest::interleavedArraysGenericStride() {
+    std::vector<UnsignedInt> result;
+    std::vector<UnsignedInt> interleaved;
+    std::tie(result, interleaved) = MeshTools::combineIndexArrays(
+        {0, 1, 2, 3,
+         0, 1, 2, 4,
+         0, 1, 2, 3,
+         5, 5, 5, 5,
+         0, 1, 2, 4}, 4);
+
+    CORRADE_COMPARE(result, (std::vector<UnsignedInt>{0, 1, 0, 2, 1}));
+    CORRADE_COMPARE(interleaved, (std::vector<UnsignedInt>{0, 1, 2, 3, 0, 1, 2, 4, 5, 5, 5, 5}));
+}
+
+void CombineIndexedArraysTest::interleavedArraysMany() {
+    /* Each combination appears three times, enough of them to have collisions
+       in the hash table */
+    std::vector<UnsignedInt> input;
+    for(UnsignedInt i = 0; i != 3; ++i)
+        for(UnsignedInt j = 0; j != 1000; ++j)
+            input.insert(input.end(), {j % 37, j/37, j % 5});
+
+    std::vector<UnsignedInt> result;
+    std::vector<UnsignedInt> interleaved;
+    std::tie(result, interleaved) = MeshTools::combineIndexArrays(input, 3);
+
+    CORRADE_COMPARE(result.size(), 3000);
+    CORRADE_COMPARE(interleaved.size(), 3000);
+    for(UnsignedInt i = 0; i != 3000; ++i)
+        CORRADE_COMPARE(result[i], i % 1000);
+    CORRADE_VERIFY(std::equal(interleaved.begin(), interleaved.end(), input.begin()));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CombineIndexedArraysTest)
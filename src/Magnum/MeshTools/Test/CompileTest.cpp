@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class CompileTest: public TestSuite::Tester {
+    public:
+        explicit CompileTest();
+
+        void prepare2D();
+        void prepare3D();
+        void prepareNotIndexed();
+};
+
+CompileTest::CompileTest() {
+    addTests({&CompileTest::prepare2D,
+              &CompileTest::prepare3D,
+              &CompileTest::prepareNotIndexed});
+}
+
+void CompileTest::prepare2D() {
+    const Trade::MeshData2D data{MeshPrimitive::Triangles, {0, 2, 1},
+        {{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}}},
+        {{{0.0f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}}}};
+
+    const PreparedMesh prepared = MeshTools::prepare(data);
+    CORRADE_COMPARE(prepared.primitive, MeshPrimitive::Triangles);
+    CORRADE_COMPARE(prepared.dimensions, 2);
+    CORRADE_COMPARE(prepared.vertexCount, 3);
+    CORRADE_COMPARE(prepared.stride, 16);
+    CORRADE_COMPARE(prepared.normalOffset, -1);
+    CORRADE_COMPARE(prepared.textureCoordinatesOffset, 8);
+    CORRADE_COMPARE(prepared.vertexData.size(), 48);
+
+    const Vector2* vertices = reinterpret_cast<const Vector2*>(prepared.vertexData.begin());
+    CORRADE_COMPARE(vertices[2], Vector2(3.0f, 4.0f));
+    CORRADE_COMPARE(vertices[3], Vector2(1.0f, 0.5f));
+
+    CORRADE_COMPARE(prepared.indexCount, 3);
+    CORRADE_COMPARE(prepared.indexType, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(prepared.indexStart, 0);
+    CORRADE_COMPARE(prepared.indexEnd, 2);
+    CORRADE_COMPARE(prepared.indexData.size(), 3);
+    CORRADE_COMPARE(prepared.indexData[1], 2);
+}
+
+void CompileTest::prepare3D() {
+    std::vector<UnsignedInt> indices{300, 301, 302};
+    std::vector<Vector3> positions(303), normals(303);
+    positions[301] = {1.0f, 2.0f, 3.0f};
+    normals[301] = Vector3::zAxis();
+    const Trade::MeshData3D data{MeshPrimitive::Triangles, std::move(indices),
+        {std::move(positions)}, {std::move(normals)}, {}};
+
+    const PreparedMesh prepared = MeshTools::prepare(data);
+    CORRADE_COMPARE(prepared.dimensions, 3);
+    CORRADE_COMPARE(prepared.vertexCount, 303);
+    CORRADE_COMPARE(prepared.stride, 24);
+    CORRADE_COMPARE(prepared.normalOffset, 12);
+    CORRADE_COMPARE(prepared.textureCoordinatesOffset, -1);
+
+    const Vector3* vertices = reinterpret_cast<const Vector3*>(prepared.vertexData.begin());
+    CORRADE_COMPARE(vertices[602], Vector3(1.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(vertices[603], Vector3::zAxis());
+
+    CORRADE_COMPARE(prepared.indexCount, 3);
+    CORRADE_COMPARE(prepared.indexType, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(prepared.indexStart, 300);
+    CORRADE_COMPARE(prepared.indexEnd, 302);
+}
+
+void CompileTest::prepareNotIndexed() {
+    const Trade::MeshData3D data{MeshPrimitive::Points, {},
+        {{{1.0f, 2.0f, 3.0f}}}, {}, {{{0.5f, 1.0f}}}};
+
+    const PreparedMesh prepared = MeshTools::prepare(data);
+    CORRADE_COMPARE(prepared.primitive, MeshPrimitive::Points);
+    CORRADE_COMPARE(prepared.stride, 20);
+    CORRADE_COMPARE(prepared.textureCoordinatesOffset, 12);
+    CORRADE_COMPARE(prepared.indexCount, 0);
+    CORRADE_VERIFY(prepared.indexData.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompileTest)
@@ -0,0 +1,194 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/EncodeIndices.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class EncodeIndicesTest: public TestSuite::Tester {
+    public:
+        EncodeIndicesTest();
+
+        void wrongIndexCount();
+        void empty();
+        void roundTrip();
+        void roundTripRandom();
+        void indexType();
+        void invalid();
+};
+
+EncodeIndicesTest::EncodeIndicesTest() {
+    addTests({&EncodeIndicesTest::wrongIndexCount,
+              &EncodeIndicesTest::empty,
+              &EncodeIndicesTest::roundTrip,
+              &EncodeIndicesTest::roundTripRandom,
+              &EncodeIndicesTest::indexType,
+              &EncodeIndicesTest::invalid});
+}
+
+namespace {
+
+/* Grid of size x size quads */
+std::vector<UnsignedInt> grid(const UnsignedInt size) {
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt i = y*(size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                       i, i + size + 2, i + size + 1});
+    }
+    return indices;
+}
+
+template<class T> std::vector<UnsignedInt> toVector(const Containers::Array<char>& data) {
+    const T* const begin = reinterpret_cast<const T*>(data.begin());
+    return std::vector<UnsignedInt>(begin, begin + data.size()/sizeof(T));
+}
+
+/* Triangles might be rotated, compare them in canonical rotation */
+std::vector<UnsignedInt> canonical(std::vector<UnsignedInt> indices) {
+    for(std::size_t i = 0; i < indices.size(); i += 3) {
+        while(indices[i] > indices[i + 1] || indices[i] > indices[i + 2]) {
+            const UnsignedInt first = indices[i];
+            indices[i] = indices[i + 1];
+            indices[i + 1] = indices[i + 2];
+            indices[i + 2] = first;
+        }
+    }
+    return indices;
+}
+
+}
+
+void EncodeIndicesTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    const Containers::Array<char> data = MeshTools::encodeIndices({0, 1});
+    CORRADE_VERIFY(!data);
+    CORRADE_COMPARE(ss.str(), "MeshTools::encodeIndices(): index count is not divisible by 3\n");
+}
+
+void EncodeIndicesTest::empty() {
+    const Containers::Array<char> encoded = MeshTools::encodeIndices({});
+
+    std::size_t indexCount;
+    Mesh::IndexType type;
+    Containers::Array<char> data;
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(encoded);
+    CORRADE_COMPARE(indexCount, 0);
+    CORRADE_VERIFY(data.empty());
+}
+
+void EncodeIndicesTest::roundTrip() {
+    std::vector<UnsignedInt> indices = grid(32);
+    MeshTools::tipsify(indices, 33*33, 24);
+
+    const Containers::Array<char> encoded = MeshTools::encodeIndices(indices);
+
+    /* Less than half the size of 16bit indices */
+    CORRADE_VERIFY(encoded.size() < indices.size());
+
+    std::size_t indexCount;
+    Mesh::IndexType type;
+    Containers::Array<char> data;
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(encoded);
+    CORRADE_COMPARE(indexCount, indices.size());
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(canonical(toVector<UnsignedShort>(data)), canonical(indices));
+}
+
+void EncodeIndicesTest::roundTripRandom() {
+    /* No adjacency or locality at all, large and non-monotonic jumps */
+    std::vector<UnsignedInt> indices;
+    UnsignedInt value = 17;
+    for(std::size_t i = 0; i != 300; ++i) {
+        value = value*1103515245u + 12345u;
+        indices.push_back(value >> 4);
+    }
+
+    std::size_t indexCount;
+    Mesh::IndexType type;
+    Containers::Array<char> data;
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(MeshTools::encodeIndices(indices));
+    CORRADE_COMPARE(indexCount, indices.size());
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE(toVector<UnsignedInt>(data), indices);
+}
+
+void EncodeIndicesTest::indexType() {
+    std::size_t indexCount;
+    Mesh::IndexType type;
+    Containers::Array<char> data;
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(MeshTools::encodeIndices({0, 1, 2, 2, 1, 3, 3, 1, 0}));
+    CORRADE_COMPARE(indexCount, 9);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(canonical(toVector<UnsignedByte>(data)), canonical({0, 1, 2, 2, 1, 3, 3, 1, 0}));
+}
+
+void EncodeIndicesTest::invalid() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    const Containers::Array<char> encoded = MeshTools::encodeIndices(grid(4));
+
+    /* Truncated */
+    std::size_t indexCount;
+    Mesh::IndexType type;
+    Containers::Array<char> data;
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices({encoded.begin(), encoded.size() - 1});
+    CORRADE_COMPARE(indexCount, 0);
+    CORRADE_VERIFY(!data);
+
+    /* Wrong version */
+    const char garbage[]{'\x7f', '\x03', '\x00', '\x00'};
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(garbage);
+    CORRADE_COMPARE(indexCount, 0);
+
+    /* Index count not divisible by 3 */
+    const char notTriangles[]{'\x01', '\x04', '\x00', '\x00'};
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(notTriangles);
+    CORRADE_COMPARE(indexCount, 0);
+
+    /* Index count larger than the data could possibly hold, shouldn't try to
+       allocate gigabytes of output */
+    const char inflated[]{'\x01', '\xfd', '\xff', '\xff', '\xff', '\x0b', '\x02', '\x00', '\x00'};
+    std::tie(indexCount, type, data) = MeshTools::decodeIndices(inflated);
+    CORRADE_COMPARE(indexCount, 0);
+    CORRADE_VERIFY(!data);
+
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::decodeIndices(): invalid or truncated data\n"
+        "MeshTools::decodeIndices(): invalid header\n"
+        "MeshTools::decodeIndices(): invalid header\n"
+        "MeshTools::decodeIndices(): invalid header\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::EncodeIndicesTest)
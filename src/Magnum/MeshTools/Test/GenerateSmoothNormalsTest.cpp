@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class GenerateSmoothNormalsTest: public TestSuite::Tester {
+    public:
+        GenerateSmoothNormalsTest();
+
+        void wrongIndexCount();
+        void angleWeighted();
+        void areaWeighted();
+        void separateIndices();
+};
+
+GenerateSmoothNormalsTest::GenerateSmoothNormalsTest() {
+    addTests({&GenerateSmoothNormalsTest::wrongIndexCount,
+              &GenerateSmoothNormalsTest::angleWeighted,
+              &GenerateSmoothNormalsTest::areaWeighted,
+              &GenerateSmoothNormalsTest::separateIndices});
+}
+
+namespace {
+
+/* Corner of a cube at origin, face in XY plane is split into two triangles,
+   last vertex is not referenced */
+const std::vector<Vector3> positions{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 1.0f, 0.0f},
+    {5.0f, 5.0f, 5.0f}
+};
+
+const std::vector<UnsignedInt> indices{
+    0, 2, 4,
+    0, 4, 1,
+    0, 1, 3,
+    0, 3, 2
+};
+
+}
+
+void GenerateSmoothNormalsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({0, 1}, positions);
+
+    CORRADE_COMPARE(normals.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateSmoothNormals(): index count is not divisible by 3\n");
+}
+
+void GenerateSmoothNormalsTest::angleWeighted() {
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions, NormalWeighting::Angle);
+
+    /* Split of the face doesn't matter, the corner normal is diagonal */
+    CORRADE_COMPARE(normals.size(), 6);
+    CORRADE_COMPARE(normals[0], -Vector3{1.0f}.normalized());
+    CORRADE_COMPARE(normals[4], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[5], Vector3{});
+}
+
+void GenerateSmoothNormalsTest::areaWeighted() {
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions, NormalWeighting::Area);
+
+    /* The face in XY plane has twice the area of the others */
+    CORRADE_COMPARE(normals.size(), 6);
+    CORRADE_COMPARE(normals[0], (-Vector3{1.0f, 1.0f, 2.0f}.normalized()));
+    CORRADE_COMPARE(normals[4], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[5], Vector3{});
+}
+
+void GenerateSmoothNormalsTest::separateIndices() {
+    /* Two triangles with the same position at the shared edge but different
+       indices stay flat */
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({
+        0, 1, 2,
+        3, 5, 4
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f}
+    });
+
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis(),
+        Vector3::yAxis(), Vector3::yAxis(), Vector3::yAxis()
+    }));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsTest)
@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class GenerateTangentsTest: public TestSuite::Tester {
+    public:
+        GenerateTangentsTest();
+
+        void wrongIndexCount();
+        void wrongAttributeCount();
+        void generate();
+        void mirrored();
+};
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addTests({&GenerateTangentsTest::wrongIndexCount,
+              &GenerateTangentsTest::wrongAttributeCount,
+              &GenerateTangentsTest::generate,
+              &GenerateTangentsTest::mirrored});
+}
+
+namespace {
+
+/*
+    Two quads in XY plane
+
+    3 -- 4 -- 5
+    |  / |  / |
+    0 -- 1 -- 2
+*/
+const std::vector<UnsignedInt> indices{
+    0, 1, 4, 0, 4, 3,
+    1, 2, 5, 1, 5, 4
+};
+
+const std::vector<Vector3> positions{
+    {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {2.0f, 1.0f, 0.0f}
+};
+
+const std::vector<Vector3> normals(6, Vector3::zAxis());
+
+}
+
+void GenerateTangentsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> outIndices, mapping;
+    std::vector<Vector4> tangents;
+    std::tie(outIndices, mapping, tangents) = MeshTools::generateTangents({0, 1}, positions, normals, std::vector<Vector2>(6));
+
+    CORRADE_VERIFY(tangents.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): index count is not divisible by 3\n");
+}
+
+void GenerateTangentsTest::wrongAttributeCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> outIndices, mapping;
+    std::vector<Vector4> tangents;
+    std::tie(outIndices, mapping, tangents) = MeshTools::generateTangents(indices, positions, normals, std::vector<Vector2>(5));
+
+    CORRADE_VERIFY(tangents.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): attribute arrays don't have the same size\n");
+}
+
+void GenerateTangentsTest::generate() {
+    /* Texture coordinates rotated by 90 degrees, with one unused vertex */
+    std::vector<Vector3> positions{MeshTools::Test::positions};
+    positions.emplace_back();
+    std::vector<Vector3> normals{MeshTools::Test::normals};
+    normals.push_back(Vector3::zAxis());
+    std::vector<Vector2> textureCoordinates;
+    for(const Vector3& position: positions)
+        textureCoordinates.emplace_back(position.y(), -position.x());
+
+    std::vector<UnsignedInt> outIndices, mapping;
+    std::vector<Vector4> tangents;
+    std::tie(outIndices, mapping, tangents) = MeshTools::generateTangents(indices, positions, normals, textureCoordinates);
+
+    /* Nothing is split */
+    CORRADE_COMPARE(outIndices, indices);
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5, 6}));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{
+        {0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 0.0f, 1.0f}
+    }));
+}
+
+void GenerateTangentsTest::mirrored() {
+    /* Texture in the right quad is mirrored around the shared edge */
+    const std::vector<Vector2> textureCoordinates{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 0.0f},
+        {0.0f, 1.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}
+    };
+
+    std::vector<UnsignedInt> outIndices, mapping;
+    std::vector<Vector4> tangents;
+    std::tie(outIndices, mapping, tangents) = MeshTools::generateTangents(indices, positions, normals, textureCoordinates);
+
+    /* Vertices on the shared edge are split */
+    CORRADE_COMPARE(outIndices, (std::vector<UnsignedInt>{
+        0, 1, 4, 0, 4, 3,
+        6, 2, 5, 6, 5, 7
+    }));
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5, 1, 4}));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{
+        {1.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f, -1.0f},
+        {-1.0f, 0.0f, 0.0f, -1.0f}, {-1.0f, 0.0f, 0.0f, -1.0f}
+    }));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
@@ -28,6 +28,7 @@
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Interleave.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -44,6 +45,10 @@ class InterleaveTest: public Corrade::TestSuite::Tester {
         void writeGaps();
 
         void interleaveInto();
+
+        void interleaveStridedInto();
+        void interleaveStridedIntoSmallBuffer();
+        void deinterleaveStrided();
 };
 
 InterleaveTest::InterleaveTest() {
@@ -54,7 +59,11 @@ InterleaveTest::InterleaveTest() {
               &InterleaveTest::write,
               &InterleaveTest::writeGaps,
 
-              &InterleaveTest::interleaveInto});
+              &InterleaveTest::interleaveInto,
+
+              &InterleaveTest::interleaveStridedInto,
+              &InterleaveTest::interleaveStridedIntoSmallBuffer,
+              &InterleaveTest::deinterleaveStrided});
 }
 
 void InterleaveTest::attributeCount() {
@@ -176,6 +185,76 @@ void InterleaveTest::interleaveInto() {
     }
 }
 
+void InterleaveTest::interleaveStridedInto() {
+    /* Every other int is used, shorts are contiguous */
+    const Int ints[]{4, -1, 5, -1, 6, -1};
+    const Short shorts[]{0, 1, 2};
+    auto data = Containers::Array<char>::from(
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77, 0x11, 0x33,
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77, 0x11, 0x33,
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77, 0x11, 0x33
+    );
+
+    MeshTools::interleaveStridedInto(data, 10, 3, {
+        {ints, sizeof(Int), 2*sizeof(Int), 1},
+        {shorts, sizeof(Short), sizeof(Short), 6}
+    });
+
+    if(!Utility::Endianness::isBigEndian()) {
+        /*  _gap, int___________________, _gap, short_____, _gap */
+        CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()), (std::vector<char>{
+            0x11, 0x04, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x11, 0x33,
+            0x11, 0x05, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x11, 0x33,
+            0x11, 0x06, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x11, 0x33
+        }));
+    } else {
+        /*  _gap, ___________________int, _gap, _____short, _gap */
+        CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()), (std::vector<char>{
+            0x11, 0x00, 0x00, 0x00, 0x04, 0x33, 0x00, 0x00, 0x11, 0x33,
+            0x11, 0x00, 0x00, 0x00, 0x05, 0x33, 0x00, 0x01, 0x11, 0x33,
+            0x11, 0x00, 0x00, 0x00, 0x06, 0x33, 0x00, 0x02, 0x11, 0x33
+        }));
+    }
+}
+
+void InterleaveTest::interleaveStridedIntoSmallBuffer() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    const Int ints[]{4, 5, 6};
+    Containers::Array<char> data{11};
+    MeshTools::interleaveStridedInto(data, 4, 3, {{ints, sizeof(Int), sizeof(Int), 0}});
+    MeshTools::interleaveStridedInto(data, 2, 3, {{ints, sizeof(Int), sizeof(Int), 0}});
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::interleaveStridedInto(): the data buffer is too small, expected 12 but got 11\n"
+        "MeshTools::interleaveStridedInto(): attribute with offset 0 and size 4 doesn't fit into stride 2\n");
+}
+
+void InterleaveTest::deinterleaveStrided() {
+    std::size_t attributeCount;
+    std::size_t stride;
+    Containers::Array<char> data;
+    std::tie(attributeCount, stride, data) = MeshTools::interleave(
+        std::vector<Byte>{0, 1, 2},
+        std::vector<Vector3>{{0.5f, 1.0f, 1.5f}, {2.0f, 2.5f, 3.0f}, {3.5f, 4.0f, 4.5f}},
+        std::vector<Short>{6, 7, 8});
+
+    /* Bytes into strided destination, positions and shorts contiguous */
+    Byte bytes[6]{};
+    Vector3 positions[3];
+    Short shorts[3];
+    MeshTools::deinterleaveStrided(data, stride, attributeCount, {
+        {bytes, sizeof(Byte), 2*sizeof(Byte), 0},
+        {positions, sizeof(Vector3), sizeof(Vector3), 1},
+        {shorts, sizeof(Short), sizeof(Short), 13}
+    });
+
+    CORRADE_COMPARE(std::vector<Byte>(bytes, bytes + 6), (std::vector<Byte>{0, 0, 1, 0, 2, 0}));
+    CORRADE_COMPARE(std::vector<Vector3>(positions, positions + 3), (std::vector<Vector3>{
+        {0.5f, 1.0f, 1.5f}, {2.0f, 2.5f, 3.0f}, {3.5f, 4.0f, 4.5f}}));
+    CORRADE_COMPARE(std::vector<Short>(shorts, shorts + 3), (std::vector<Short>{6, 7, 8}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveTest)
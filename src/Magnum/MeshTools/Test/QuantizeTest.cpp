@@ -0,0 +1,166 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Quantize.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class QuantizeTest: public TestSuite::Tester {
+    public:
+        QuantizeTest();
+
+        void positions();
+        void normalsOctahedral();
+        void normalsPacked();
+        void textureCoordinates();
+        void half();
+};
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::positions,
+              &QuantizeTest::normalsOctahedral,
+              &QuantizeTest::normalsPacked,
+              &QuantizeTest::textureCoordinates,
+              &QuantizeTest::half});
+}
+
+namespace {
+
+const std::vector<Vector3> normals{
+    Vector3::xAxis(), -Vector3::yAxis(), Vector3::zAxis(), -Vector3::zAxis(),
+    Vector3{1.0f, 1.0f, 1.0f}.normalized(),
+    Vector3{-1.0f, 0.5f, -2.0f}.normalized(),
+    Vector3{0.3f, -0.7f, -0.1f}.normalized()
+};
+
+}
+
+void QuantizeTest::positions() {
+    const std::vector<Vector3> positions{
+        {-1.0f, 2.0f, 0.5f},
+        { 3.0f, 2.0f, 0.0f},
+        { 0.25f, 1.0f, -1.0f}};
+
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    Matrix4 dequantization;
+    Float error;
+    std::tie(quantized, dequantization, error) = MeshTools::quantizePositions(positions);
+
+    /* Scale is given by the largest extent (X), Y and Z don't span the whole
+       range */
+    CORRADE_COMPARE(quantized.size(), 3);
+    CORRADE_COMPARE(quantized[0], (Math::Vector3<UnsignedShort>{0, 16384, 24576}));
+    CORRADE_COMPARE(quantized[1], (Math::Vector3<UnsignedShort>{65535, 16384, 16384}));
+    CORRADE_COMPARE(dequantization, Matrix4::translation({-1.0f, 1.0f, -1.0f})*Matrix4::scaling(Vector3(4.0f)));
+
+    /* Dequantized positions are within the error */
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Vector3 dequantized = dequantization.transformPoint(Math::normalize<Vector3>(quantized[i]));
+        CORRADE_VERIFY((dequantized - positions[i]).length() <= error + 1.0e-6f);
+    }
+    CORRADE_VERIFY(error < 4.0f/65535.0f);
+
+    /* Empty input */
+    std::tie(quantized, dequantization, error) = MeshTools::quantizePositions({});
+    CORRADE_VERIFY(quantized.empty());
+    CORRADE_COMPARE(error, 0.0f);
+}
+
+void QuantizeTest::normalsOctahedral() {
+    std::vector<Math::Vector2<Byte>> encoded8;
+    Float error8;
+    std::tie(encoded8, error8) = MeshTools::quantizeNormalsOctahedral<Byte>(normals);
+    CORRADE_COMPARE(encoded8.size(), normals.size());
+    CORRADE_COMPARE(encoded8[0], (Math::Vector2<Byte>{127, 0}));
+    CORRADE_COMPARE(encoded8[2], (Math::Vector2<Byte>{0, 0}));
+    CORRADE_VERIFY(error8 > 0.0f);
+    CORRADE_VERIFY(error8 < Float(Rad(Deg(2.0f))));
+
+    std::vector<Math::Vector2<Short>> encoded16;
+    Float error16;
+    std::tie(encoded16, error16) = MeshTools::quantizeNormalsOctahedral<Short>(normals);
+    CORRADE_VERIFY(error16 < error8);
+    CORRADE_VERIFY(error16 < Float(Rad(Deg(0.01f))));
+
+    /* Round trip */
+    for(std::size_t i = 0; i != normals.size(); ++i)
+        CORRADE_VERIFY((MeshTools::decodeNormalOctahedral(Math::normalize<Vector2>(encoded16[i])) - normals[i]).length() < 1.0e-4f);
+}
+
+void QuantizeTest::normalsPacked() {
+    std::vector<UnsignedInt> packed;
+    Float error;
+    std::tie(packed, error) = MeshTools::quantizeNormalsPacked(normals);
+
+    CORRADE_COMPARE(packed.size(), normals.size());
+    CORRADE_COMPARE(packed[0], 0x000001ff);
+    CORRADE_COMPARE(packed[1], 0x00080400);
+    CORRADE_COMPARE(packed[3], 0x20100000);
+    CORRADE_VERIFY(error > 0.0f);
+    CORRADE_VERIFY(error < Float(Rad(Deg(0.5f))));
+}
+
+void QuantizeTest::textureCoordinates() {
+    std::vector<Math::Vector2<UnsignedShort>> quantized;
+    Float error;
+    std::tie(quantized, error) = MeshTools::quantizeTextureCoordinates({
+        {0.0f, 1.0f}, {0.5f, 0.25f}, {0.1f, 2.0f}});
+
+    CORRADE_COMPARE(quantized.size(), 3);
+    CORRADE_COMPARE(quantized[0], (Math::Vector2<UnsignedShort>{0x0000, 0x3c00}));
+    CORRADE_COMPARE(quantized[1], (Math::Vector2<UnsignedShort>{0x3800, 0x3400}));
+    CORRADE_COMPARE(quantized[2], (Math::Vector2<UnsignedShort>{0x2e66, 0x4000}));
+    CORRADE_COMPARE(error, std::abs(MeshTools::unpackHalf(0x2e66) - 0.1f));
+}
+
+void QuantizeTest::half() {
+    CORRADE_COMPARE(MeshTools::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(MeshTools::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(MeshTools::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(MeshTools::packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(MeshTools::packHalf(65504.0f), 0x7bff);
+    CORRADE_COMPARE(MeshTools::packHalf(1.0e6f), 0x7c00);
+    CORRADE_COMPARE(MeshTools::packHalf(std::numeric_limits<Float>::quiet_NaN()), 0x7e00);
+
+    /* Smallest denormal, rounding to nearest even */
+    CORRADE_COMPARE(MeshTools::packHalf(5.9604645e-8f), 0x0001);
+    CORRADE_COMPARE(MeshTools::packHalf(1.0f + 1.0f/2048.0f), 0x3c00);
+    CORRADE_COMPARE(MeshTools::packHalf(1.0f + 3.0f/2048.0f), 0x3c02);
+
+    CORRADE_COMPARE(MeshTools::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(MeshTools::unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(MeshTools::unpackHalf(0x7bff), 65504.0f);
+    CORRADE_COMPARE(MeshTools::unpackHalf(0x0001), 5.9604645e-8f);
+    CORRADE_COMPARE(MeshTools::unpackHalf(0x7c00), std::numeric_limits<Float>::infinity());
+    CORRADE_VERIFY(MeshTools::unpackHalf(0x7e00) != MeshTools::unpackHalf(0x7e00));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SimplifyTest: public TestSuite::Tester {
+    public:
+        SimplifyTest();
+
+        void wrongIndexCount();
+        void simplifyPlanar();
+        void simplifyTargetError();
+        void simplifySeam();
+        void lods();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::wrongIndexCount,
+              &SimplifyTest::simplifyPlanar,
+              &SimplifyTest::simplifyTargetError,
+              &SimplifyTest::simplifySeam,
+              &SimplifyTest::lods});
+}
+
+namespace {
+
+/*
+    5x5 grid of vertices on XY plane, all vertices except the border ones can
+    be collapsed
+
+    0 -- 1 -- 2 -- 3 -- 4
+    |    |    |    |    |
+    5 -- 6 -- 7 -- 8 -- 9
+    ...
+*/
+void grid(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, Float centerHeight) {
+    for(Int y = 0; y != 5; ++y) for(Int x = 0; x != 5; ++x)
+        positions.push_back({Float(x), Float(y), x == 2 && y == 2 ? centerHeight : 0.0f});
+
+    for(UnsignedInt y = 0; y != 4; ++y) for(UnsignedInt x = 0; x != 4; ++x) {
+        const UnsignedInt a = y*5 + x;
+        indices.insert(indices.end(), {a, a + 1, a + 6, a, a + 6, a + 5});
+    }
+}
+
+}
+
+void SimplifyTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::simplify(indices, std::vector<Vector3>{}, 0);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::simplify(): index count is not divisible by 3!\n");
+}
+
+void SimplifyTest::simplifyPlanar() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 0.0f);
+
+    /* Only 16 border vertices are locked, triangulation of 16-gon has 14
+       triangles */
+    const Float error = MeshTools::simplify(indices, positions, 0);
+    CORRADE_COMPARE(error, 0.0f);
+    CORRADE_COMPARE(indices.size(), 14*3);
+
+    /* No interior vertex is referenced anymore */
+    for(const UnsignedInt index: indices) {
+        const UnsignedInt x = index%5, y = index/5;
+        CORRADE_VERIFY(x == 0 || x == 4 || y == 0 || y == 4);
+    }
+}
+
+void SimplifyTest::simplifyTargetError() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 1.0f);
+
+    /* The bump can't be collapsed with zero error */
+    CORRADE_COMPARE(MeshTools::simplify(indices, positions, 0, 0.0f), 0.0f);
+    CORRADE_VERIFY(indices.size() < 32*3);
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), 12) != indices.end());
+
+    /* But can with larger one */
+    const Float error = MeshTools::simplify(indices, positions, 0, 1.0f);
+    CORRADE_VERIFY(error > 0.0f && error <= 1.0f);
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), 12) == indices.end());
+}
+
+void SimplifyTest::simplifySeam() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 0.0f);
+
+    /* Duplicate the center vertex as if there was a texture seam */
+    positions.push_back(positions[12]);
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        if(indices[i] == 6 && indices[i+2] == 11)
+            for(std::size_t j = 0; j != 3; ++j)
+                if(indices[i+j] == 12) indices[i+j] = 25;
+
+    MeshTools::simplify(indices, positions, 0);
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), 12) != indices.end());
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), 25) != indices.end());
+}
+
+void SimplifyTest::lods() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 0.0f);
+
+    const std::vector<std::vector<UnsignedInt>> lods = MeshTools::generateLods(indices, positions, 10);
+
+    /* Stops when nothing can be simplified anymore */
+    CORRADE_VERIFY(lods.size() > 1 && lods.size() < 10);
+    CORRADE_COMPARE(lods.front(), indices);
+    CORRADE_COMPARE(lods.back().size(), 14*3);
+    for(std::size_t i = 1; i != lods.size(); ++i)
+        CORRADE_VERIFY(lods[i].size() < lods[i-1].size());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
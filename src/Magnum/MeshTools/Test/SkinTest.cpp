@@ -0,0 +1,182 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Skin.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SkinTest: public TestSuite::Tester {
+    public:
+        explicit SkinTest();
+
+        void wrongJointCount();
+        void wrongNormalCount();
+        void jointOutOfRange();
+
+        void linearBlend();
+        void linearBlendNoNormals();
+        void dualQuaternion();
+        void dualQuaternionAntipodal();
+        void dualQuaternionLinearBlendTranslation();
+};
+
+SkinTest::SkinTest() {
+    addTests({&SkinTest::wrongJointCount,
+              &SkinTest::wrongNormalCount,
+              &SkinTest::jointOutOfRange,
+
+              &SkinTest::linearBlend,
+              &SkinTest::linearBlendNoNormals,
+              &SkinTest::dualQuaternion,
+              &SkinTest::dualQuaternionAntipodal,
+              &SkinTest::dualQuaternionLinearBlendTranslation});
+}
+
+void SkinTest::wrongJointCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<Vector3> positions, normals;
+    MeshTools::skin(std::vector<Matrix4>{Matrix4()}, {Vector4ui()}, {}, {Vector3()}, {}, positions, normals);
+    CORRADE_COMPARE(out.str(), "MeshTools::skin(): joint index and weight count doesn't match vertex count\n");
+}
+
+void SkinTest::wrongNormalCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<Vector3> positions, normals;
+    MeshTools::skin(std::vector<DualQuaternion>{DualQuaternion()}, {Vector4ui()}, {Vector4(1.0f, 0.0f, 0.0f, 0.0f)}, {Vector3()}, {Vector3(), Vector3()}, positions, normals);
+    CORRADE_COMPARE(out.str(), "MeshTools::skin(): normal count doesn't match vertex count\n");
+}
+
+void SkinTest::jointOutOfRange() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<Vector3> positions, normals;
+    MeshTools::skin(std::vector<Matrix4>{Matrix4()}, {Vector4ui(0, 0, 1, 0)}, {Vector4(0.5f, 0.0f, 0.5f, 0.0f)}, {Vector3()}, {}, positions, normals);
+    CORRADE_COMPARE(out.str(), "MeshTools::skin(): joint index out of range\n");
+}
+
+void SkinTest::linearBlend() {
+    const std::vector<Matrix4> joints{
+        Matrix4::translation({2.0f, 0.0f, 0.0f}),
+        Matrix4::rotationZ(Deg(90.0f)),
+        Matrix4::scaling(Vector3(3.0f))
+    };
+
+    std::vector<Vector3> positions, normals;
+    MeshTools::skin(joints,
+        {Vector4ui(0, 0, 0, 0), Vector4ui(2, 1, 7, 7), Vector4ui(1, 0, 0, 0)},
+        {Vector4(1.0f, 0.0f, 0.0f, 0.0f), Vector4(0.5f, 0.5f, 0.0f, 0.0f), Vector4(1.0f, 0.0f, 0.0f, 0.0f)},
+        {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},
+        {Vector3::xAxis(), Vector3::xAxis(), Vector3::xAxis()},
+        positions, normals);
+
+    /* Unused slots with out-of-range indices aren't touched */
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{
+        {3.0f, 0.0f, 0.0f},
+        {1.5f, 0.5f, 0.0f},
+        {0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3::xAxis(),
+        Vector3(1.5f, 0.5f, 0.0f).normalized(),
+        Vector3::yAxis()}));
+}
+
+void SkinTest::linearBlendNoNormals() {
+    std::vector<Vector3> positions;
+    std::vector<Vector3> normals{Vector3(7.0f)};
+    MeshTools::skin(std::vector<Matrix4>{Matrix4::translation(Vector3::zAxis())},
+        {Vector4ui()}, {Vector4(1.0f, 0.0f, 0.0f, 0.0f)}, {Vector3()}, {},
+        positions, normals);
+
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{Vector3::zAxis()}));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{Vector3(7.0f)}));
+}
+
+void SkinTest::dualQuaternion() {
+    const std::vector<DualQuaternion> joints{
+        DualQuaternion(),
+        DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis())
+    };
+
+    std::vector<Vector3> positions, normals;
+    MeshTools::skin(joints,
+        {Vector4ui(0, 1, 0, 0)},
+        {Vector4(0.5f, 0.5f, 0.0f, 0.0f)},
+        {{2.0f, 0.0f, 0.0f}},
+        {Vector3::xAxis()},
+        positions, normals);
+
+    /* Halfway rotation, preserving distance from the joint (linear blend
+       would shrink it to 1.414) */
+    const Float sqrt2 = Constants::sqrt2();
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{{sqrt2, sqrt2, 0.0f}}));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{Vector3(1.0f, 1.0f, 0.0f)/sqrt2}));
+}
+
+void SkinTest::dualQuaternionAntipodal() {
+    /* Negated dual quaternion represents the same transformation and
+       shouldn't cancel out the first one */
+    const DualQuaternion a = DualQuaternion::translation({0.0f, 1.0f, 0.0f})*
+        DualQuaternion::rotation(Deg(30.0f), Vector3::zAxis());
+    const std::vector<DualQuaternion> joints{a, DualQuaternion(a.real()*-1.0f, a.dual()*-1.0f)};
+
+    std::vector<Vector3> positions, normals;
+    MeshTools::skin(joints,
+        {Vector4ui(0, 1, 0, 0)},
+        {Vector4(0.5f, 0.5f, 0.0f, 0.0f)},
+        {{1.0f, 0.0f, 0.0f}}, {},
+        positions, normals);
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{a.transformPointNormalized({1.0f, 0.0f, 0.0f})}));
+}
+
+void SkinTest::dualQuaternionLinearBlendTranslation() {
+    /* For pure translations both methods give the same result */
+    const Vector3 a{1.0f, 2.0f, 0.0f}, b{-1.0f, 0.0f, 4.0f};
+    const std::vector<Vector4ui> jointIndices{Vector4ui(0, 1, 0, 0)};
+    const std::vector<Vector4> jointWeights{Vector4(0.25f, 0.75f, 0.0f, 0.0f)};
+    const std::vector<Vector3> bindPositions{{1.0f, 1.0f, 1.0f}};
+
+    std::vector<Vector3> linear, dual, normals;
+    MeshTools::skin(std::vector<Matrix4>{Matrix4::translation(a), Matrix4::translation(b)},
+        jointIndices, jointWeights, bindPositions, {}, linear, normals);
+    MeshTools::skin(std::vector<DualQuaternion>{DualQuaternion::translation(a), DualQuaternion::translation(b)},
+        jointIndices, jointWeights, bindPositions, {}, dual, normals);
+
+    CORRADE_COMPARE(linear, (std::vector<Vector3>{{0.5f, 1.5f, 4.0f}}));
+    CORRADE_COMPARE(dual, linear);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SkinTest)
@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/SpatialSort.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SpatialSortTest: public TestSuite::Tester {
+    public:
+        explicit SpatialSortTest();
+
+        void mortonKey();
+        void hilbertKey();
+        void vertices();
+        void verticesIndexed();
+        void verticesDegenerate();
+        void triangles();
+        void trianglesWrongIndexCount();
+};
+
+SpatialSortTest::SpatialSortTest() {
+    addTests({&SpatialSortTest::mortonKey,
+              &SpatialSortTest::hilbertKey,
+              &SpatialSortTest::vertices,
+              &SpatialSortTest::verticesIndexed,
+              &SpatialSortTest::verticesDegenerate,
+              &SpatialSortTest::triangles,
+              &SpatialSortTest::trianglesWrongIndexCount});
+}
+
+void SpatialSortTest::mortonKey() {
+    CORRADE_COMPARE(Implementation::mortonKey(0, 0, 0), 0);
+    CORRADE_COMPARE(Implementation::mortonKey(0, 0, 1), 1);
+    CORRADE_COMPARE(Implementation::mortonKey(0, 1, 0), 2);
+    CORRADE_COMPARE(Implementation::mortonKey(1, 0, 0), 4);
+    CORRADE_COMPARE(Implementation::mortonKey(3, 0, 5), 0x65);
+    CORRADE_COMPARE(Implementation::mortonKey(1023, 1023, 1023), 0x3fffffff);
+}
+
+void SpatialSortTest::hilbertKey() {
+    /* The first 4096 cells of the curve fill 16x16x16 cube, each of them
+       exactly once and consecutive cells are adjacent */
+    std::vector<Vector3i> cells(4096, Vector3i(-1));
+    for(Int z = 0; z != 16; ++z) for(Int y = 0; y != 16; ++y) for(Int x = 0; x != 16; ++x) {
+        const UnsignedInt key = Implementation::hilbertKey(x, y, z);
+        CORRADE_VERIFY(key < 4096);
+        CORRADE_COMPARE(cells[key], Vector3i(-1));
+        cells[key] = {x, y, z};
+    }
+
+    for(std::size_t i = 1; i != cells.size(); ++i) {
+        const Vector3i d = cells[i] - cells[i - 1];
+        CORRADE_COMPARE(std::abs(d.x()) + std::abs(d.y()) + std::abs(d.z()), 1);
+    }
+}
+
+void SpatialSortTest::vertices() {
+    const std::vector<Vector3> positions{
+        {1.0f, 1.0f, 1.0f},
+        {0.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f}};
+
+    CORRADE_COMPARE(MeshTools::spatialSortVertices(positions, SpatialCurve::Morton),
+        (std::vector<UnsignedInt>{1, 2, 3, 0}));
+
+    /* Hilbert curve starts and ends at the same face */
+    const std::vector<UnsignedInt> mapping = MeshTools::spatialSortVertices(positions, SpatialCurve::Hilbert);
+    CORRADE_COMPARE(mapping[0], 1);
+    CORRADE_COMPARE(MeshTools::duplicate(mapping, positions)[3].x(), 1.0f);
+}
+
+void SpatialSortTest::verticesIndexed() {
+    const std::vector<Vector3> positions{
+        {1.0f, 1.0f, 1.0f},
+        {0.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2, 2, 1, 3};
+    const std::vector<Vector3> original = MeshTools::duplicate(indices, positions);
+
+    const std::vector<UnsignedInt> mapping = MeshTools::spatialSortVertices(indices, positions, SpatialCurve::Morton);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{3, 0, 1, 1, 0, 2}));
+    CORRADE_COMPARE(MeshTools::duplicate(indices, MeshTools::duplicate(mapping, positions)), original);
+}
+
+void SpatialSortTest::verticesDegenerate() {
+    /* All points are the same, the order is kept */
+    CORRADE_COMPARE(MeshTools::spatialSortVertices(std::vector<Vector3>(3, Vector3(2.0f))),
+        (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_VERIFY(MeshTools::spatialSortVertices(std::vector<Vector3>{}).empty());
+}
+
+void SpatialSortTest::triangles() {
+    const std::vector<Vector3> positions{
+        {10.0f, 10.0f, 0.0f}, {11.0f, 10.0f, 0.0f}, {10.0f, 11.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2, 3, 4, 5};
+
+    MeshTools::spatialSortTriangles(indices, positions);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{3, 4, 5, 0, 1, 2}));
+}
+
+void SpatialSortTest::trianglesWrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::spatialSortTriangles(indices, {{}, {}});
+    CORRADE_COMPARE(out.str(), "MeshTools::spatialSortTriangles(): index count is not divisible by 3\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SpatialSortTest)
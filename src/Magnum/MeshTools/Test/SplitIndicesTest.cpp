@@ -0,0 +1,134 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/SplitIndices.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SplitIndicesTest: public TestSuite::Tester {
+    public:
+        explicit SplitIndicesTest();
+
+        void wrongIndexCount();
+        void empty();
+        void noSplit();
+        void split();
+        void splitLarge();
+        void meshData();
+};
+
+SplitIndicesTest::SplitIndicesTest() {
+    addTests({&SplitIndicesTest::wrongIndexCount,
+              &SplitIndicesTest::empty,
+              &SplitIndicesTest::noSplit,
+              &SplitIndicesTest::split,
+              &SplitIndicesTest::splitLarge,
+              &SplitIndicesTest::meshData});
+}
+
+void SplitIndicesTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+    MeshTools::splitIndices(std::vector<UnsignedInt>{0, 1});
+    MeshTools::splitIndices(std::vector<UnsignedInt>{0, 1, 2}, 2);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::splitIndices(): index count is not divisible by 3\n"
+        "MeshTools::splitIndices(): expected at least 3 vertices but got 2\n");
+}
+
+void SplitIndicesTest::empty() {
+    CORRADE_VERIFY(MeshTools::splitIndices(std::vector<UnsignedInt>{}).empty());
+}
+
+void SplitIndicesTest::noSplit() {
+    const auto chunks = MeshTools::splitIndices(std::vector<UnsignedInt>{7, 3, 5, 5, 3, 9});
+    CORRADE_COMPARE(chunks.size(), 1);
+    CORRADE_COMPARE(std::get<0>(chunks[0]), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3}));
+    CORRADE_COMPARE(std::get<1>(chunks[0]), (std::vector<UnsignedInt>{7, 3, 5, 9}));
+}
+
+void SplitIndicesTest::split() {
+    /* Strip of quads, second triangle of each quad adds one vertex, first
+       one too, except for the first quad */
+    const std::vector<UnsignedInt> indices{
+        0, 1, 2, 2, 1, 3,
+        2, 3, 4, 4, 3, 5,
+        4, 5, 6, 6, 5, 7};
+
+    const auto chunks = MeshTools::splitIndices(indices, 5);
+    CORRADE_COMPARE(chunks.size(), 2);
+    CORRADE_COMPARE(std::get<0>(chunks[0]), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3, 2, 3, 4}));
+    CORRADE_COMPARE(std::get<1>(chunks[0]), (std::vector<UnsignedInt>{0, 1, 2, 3, 4}));
+    CORRADE_COMPARE(std::get<0>(chunks[1]), (std::vector<UnsignedInt>{0, 1, 2, 0, 2, 3, 3, 2, 4}));
+    CORRADE_COMPARE(std::get<1>(chunks[1]), (std::vector<UnsignedInt>{4, 3, 5, 6, 7}));
+}
+
+void SplitIndicesTest::splitLarge() {
+    /* Grid with more than 65536 vertices */
+    constexpr UnsignedInt Size = 300;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt i = y*(Size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + Size + 2,
+                                       i, i + Size + 2, i + Size + 1});
+    }
+
+    const auto chunks = MeshTools::splitIndices(indices);
+    CORRADE_VERIFY(chunks.size() > 1);
+
+    /* Order of the triangles is preserved */
+    std::vector<UnsignedInt> expanded;
+    for(const auto& chunk: chunks) {
+        CORRADE_VERIFY(std::get<1>(chunk).size() <= 65536);
+        const std::vector<UnsignedInt> original = MeshTools::duplicate(std::get<0>(chunk), std::get<1>(chunk));
+        expanded.insert(expanded.end(), original.begin(), original.end());
+    }
+    CORRADE_COMPARE(expanded, indices);
+}
+
+void SplitIndicesTest::meshData() {
+    const Trade::MeshData3D data{MeshPrimitive::Triangles, {0, 1, 2, 2, 1, 3},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}}},
+        {{Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis(), Vector3::xAxis()}},
+        {{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}}}};
+
+    const std::vector<Trade::MeshData3D> chunks = MeshTools::splitIndices(data, 3);
+    CORRADE_COMPARE(chunks.size(), 2);
+    CORRADE_COMPARE(chunks[1].primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(chunks[1].indices(), (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(chunks[1].positions(0), (std::vector<Vector3>{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(chunks[1].normals(0), (std::vector<Vector3>{Vector3::zAxis(), Vector3::zAxis(), Vector3::xAxis()}));
+    CORRADE_COMPARE(chunks[1].textureCoords2D(0), (std::vector<Vector2>{{0.0f, 1.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SplitIndicesTest)
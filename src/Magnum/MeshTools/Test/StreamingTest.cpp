@@ -0,0 +1,301 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+#include "Magnum/MeshTools/Streaming.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class StreamingTest: public TestSuite::Tester {
+    public:
+        StreamingTest();
+
+        void removeDuplicates();
+        void removeDuplicatesTruncated();
+        void removeDuplicatesManyDuplicates();
+        void generateSmoothNormals();
+        void generateSmoothNormalsOutOfRange();
+        void encodeDecodeIndices();
+        void decodeIndicesTruncated();
+        void decodeIndicesInvalidChunkSize();
+        void buildMeshlets();
+        void writeFailed();
+};
+
+StreamingTest::StreamingTest() {
+    addTests({&StreamingTest::removeDuplicates,
+              &StreamingTest::removeDuplicatesTruncated,
+              &StreamingTest::removeDuplicatesManyDuplicates,
+              &StreamingTest::generateSmoothNormals,
+              &StreamingTest::generateSmoothNormalsOutOfRange,
+              &StreamingTest::encodeDecodeIndices,
+              &StreamingTest::decodeIndicesTruncated,
+              &StreamingTest::decodeIndicesInvalidChunkSize,
+              &StreamingTest::buildMeshlets,
+              &StreamingTest::writeFailed});
+}
+
+namespace {
+
+template<class T> std::string toString(const std::vector<T>& data) {
+    return std::string(reinterpret_cast<const char*>(data.data()), data.size()*sizeof(T));
+}
+
+template<class T> std::vector<T> fromString(const std::string& data) {
+    const T* const begin = reinterpret_cast<const T*>(data.data());
+    return std::vector<T>(begin, begin + data.size()/sizeof(T));
+}
+
+/* Grid of size x size quads with shared vertices, slightly bumpy */
+void grid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    for(UnsignedInt y = 0; y <= size; ++y) for(UnsignedInt x = 0; x <= size; ++x)
+        positions.push_back({Float(x), Float(y), Float((x*7 + y*13) % 5)*0.1f});
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt i = y*(size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                       i, i + size + 2, i + size + 1});
+    }
+}
+
+/* Small memory limit to force many partitions, chunks and page evictions */
+constexpr std::size_t MemoryLimit = 4096;
+
+}
+
+void StreamingTest::removeDuplicates() {
+    std::vector<UnsignedInt> gridIndices;
+    std::vector<Vector3> gridPositions;
+    grid(128, gridIndices, gridPositions);
+
+    /* Each triangle has its own vertices */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    for(UnsignedInt index: gridIndices) {
+        indices.push_back(positions.size());
+        positions.push_back(gridPositions[index]);
+    }
+
+    std::istringstream positionsIn{toString(positions)}, indicesIn{toString(indices)};
+    std::ostringstream positionsOut, indicesOut;
+    std::size_t vertexCount;
+    CORRADE_VERIFY(Streaming::removeDuplicates(positionsIn, positions.size(), indicesIn, indices.size(), positionsOut, indicesOut, vertexCount, MemoryLimit));
+
+    const std::vector<Vector3> outPositions = fromString<Vector3>(positionsOut.str());
+    const std::vector<UnsignedInt> outIndices = fromString<UnsignedInt>(indicesOut.str());
+    CORRADE_COMPARE(vertexCount, gridPositions.size());
+    CORRADE_COMPARE(outPositions.size(), gridPositions.size());
+    CORRADE_COMPARE(outIndices.size(), indices.size());
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_COMPARE(outPositions[outIndices[i]], positions[indices[i]]);
+}
+
+void StreamingTest::removeDuplicatesTruncated() {
+    std::istringstream positionsIn{std::string(20, '\0')}, indicesIn;
+    std::ostringstream positionsOut, indicesOut;
+    std::size_t vertexCount;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!Streaming::removeDuplicates(positionsIn, 2, indicesIn, 0, positionsOut, indicesOut, vertexCount));
+    CORRADE_COMPARE(out.str(), "MeshTools::Streaming::removeDuplicates(): can't read positions\n");
+}
+
+void StreamingTest::removeDuplicatesManyDuplicates() {
+    /* All copies of a position end up in the same partition, which is then
+       much larger than the memory limit and has to be merged from runs */
+    const Vector3 distinct[]{{0.0f, 1.0f, 2.0f},
+                             {3.0f, 4.0f, 5.0f},
+                             {6.0f, 7.0f, 8.0f}};
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt i = 0; i != 3000; ++i) {
+        positions.push_back(distinct[(i*7) % 3]);
+        indices.push_back(2999 - i);
+    }
+
+    std::istringstream positionsIn{toString(positions)}, indicesIn{toString(indices)};
+    std::ostringstream positionsOut, indicesOut;
+    std::size_t vertexCount;
+    CORRADE_VERIFY(Streaming::removeDuplicates(positionsIn, positions.size(), indicesIn, indices.size(), positionsOut, indicesOut, vertexCount, MemoryLimit));
+
+    const std::vector<Vector3> outPositions = fromString<Vector3>(positionsOut.str());
+    const std::vector<UnsignedInt> outIndices = fromString<UnsignedInt>(indicesOut.str());
+    CORRADE_COMPARE(vertexCount, 3);
+    CORRADE_COMPARE(outPositions.size(), 3);
+    CORRADE_COMPARE(outIndices.size(), indices.size());
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_COMPARE(outPositions[outIndices[i]], positions[indices[i]]);
+}
+
+void StreamingTest::generateSmoothNormals() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(128, indices, positions);
+
+    std::istringstream indicesIn{toString(indices)}, positionsIn{toString(positions)};
+    std::ostringstream normalsOut;
+    CORRADE_VERIFY(Streaming::generateSmoothNormals(indicesIn, indices.size(), positionsIn, positions.size(), normalsOut, NormalWeighting::Angle, MemoryLimit));
+
+    const std::vector<Vector3> normals = fromString<Vector3>(normalsOut.str());
+    const std::vector<Vector3> expected = MeshTools::generateSmoothNormals(indices, positions);
+    CORRADE_COMPARE(normals.size(), expected.size());
+    for(std::size_t i = 0; i != normals.size(); ++i)
+        CORRADE_COMPARE(normals[i], expected[i]);
+}
+
+void StreamingTest::generateSmoothNormalsOutOfRange() {
+    const std::vector<UnsignedInt> indices{0, 1, 3};
+    const std::vector<Vector3> positions{{}, Vector3::xAxis(), Vector3::yAxis()};
+
+    std::istringstream indicesIn{toString(indices)}, positionsIn{toString(positions)};
+    std::ostringstream normalsOut;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!Streaming::generateSmoothNormals(indicesIn, indices.size(), positionsIn, positions.size(), normalsOut));
+    CORRADE_COMPARE(out.str(), "MeshTools::Streaming::generateSmoothNormals(): index out of range\n");
+}
+
+void StreamingTest::encodeDecodeIndices() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(128, indices, positions);
+
+    std::istringstream indicesIn{toString(indices)};
+    std::stringstream encoded;
+    CORRADE_VERIFY(Streaming::encodeIndices(indicesIn, indices.size(), encoded, MemoryLimit));
+    CORRADE_VERIFY(encoded.str().size() < indices.size()*sizeof(UnsignedInt)/2);
+
+    std::ostringstream indicesOut;
+    std::size_t indexCount;
+    CORRADE_VERIFY(Streaming::decodeIndices(encoded, indicesOut, indexCount));
+    CORRADE_COMPARE(indexCount, indices.size());
+
+    /* Triangles might be rotated, compare their vertex sets */
+    const std::vector<UnsignedInt> decoded = fromString<UnsignedInt>(indicesOut.str());
+    CORRADE_COMPARE(decoded.size(), indices.size());
+    for(std::size_t i = 0; i < indices.size(); i += 3) {
+        const UnsignedInt a = decoded[i], b = decoded[i + 1], c = decoded[i + 2];
+        CORRADE_VERIFY((a == indices[i] && b == indices[i + 1] && c == indices[i + 2]) ||
+                       (a == indices[i + 1] && b == indices[i + 2] && c == indices[i]) ||
+                       (a == indices[i + 2] && b == indices[i] && c == indices[i + 1]));
+    }
+}
+
+void StreamingTest::decodeIndicesTruncated() {
+    const std::vector<UnsignedInt> indices{0, 1, 2};
+
+    std::istringstream indicesIn{toString(indices)};
+    std::ostringstream encoded;
+    CORRADE_VERIFY(Streaming::encodeIndices(indicesIn, indices.size(), encoded));
+
+    /* Drop the terminating zero size */
+    std::string data = encoded.str();
+    data.resize(data.size() - 4);
+    std::istringstream encodedIn{data};
+    std::ostringstream indicesOut;
+    std::size_t indexCount;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!Streaming::decodeIndices(encodedIn, indicesOut, indexCount));
+    CORRADE_COMPARE(out.str(), "MeshTools::Streaming::decodeIndices(): can't read chunk size\n");
+}
+
+void StreamingTest::decodeIndicesInvalidChunkSize() {
+    /* Chunk size much larger than the actual data, shouldn't try to allocate
+       it */
+    const UnsignedInt size = 0xfffffff0u;
+    std::string data(reinterpret_cast<const char*>(&size), 4);
+    data += std::string(16, '\0');
+    std::istringstream encodedIn{data};
+    std::ostringstream indicesOut;
+    std::size_t indexCount;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!Streaming::decodeIndices(encodedIn, indicesOut, indexCount));
+    CORRADE_COMPARE(out.str(), "MeshTools::Streaming::decodeIndices(): can't read chunk data\n");
+}
+
+void StreamingTest::buildMeshlets() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(128, indices, positions);
+
+    std::istringstream indicesIn{toString(indices)}, positionsIn{toString(positions)};
+    std::ostringstream meshletsOut, verticesOut, trianglesOut, chunksOut;
+    std::size_t meshletCount, chunkCount;
+    CORRADE_VERIFY(Streaming::buildMeshlets(indicesIn, indices.size(), positionsIn, positions.size(), meshletsOut, verticesOut, trianglesOut, chunksOut, meshletCount, chunkCount, 64, 126, MemoryLimit));
+
+    const std::vector<Meshlet> meshlets = fromString<Meshlet>(meshletsOut.str());
+    const std::vector<UnsignedInt> vertices = fromString<UnsignedInt>(verticesOut.str());
+    const std::vector<UnsignedByte> triangles = fromString<UnsignedByte>(trianglesOut.str());
+    const std::vector<Streaming::MeshletChunk> chunks = fromString<Streaming::MeshletChunk>(chunksOut.str());
+    CORRADE_COMPARE(meshlets.size(), meshletCount);
+    CORRADE_COMPARE(chunks.size(), chunkCount);
+
+    /* The memory limit is small enough to need more than one chunk */
+    CORRADE_VERIFY(chunkCount > 1);
+    CORRADE_COMPARE(chunks[0].meshletOffset, 0);
+
+    /* Triangles are processed in order, expanding the meshlets gives back
+       the original indices */
+    std::vector<UnsignedInt> expanded;
+    for(std::size_t i = 0; i != chunks.size(); ++i) {
+        const std::size_t end = i + 1 == chunks.size() ? meshletCount : chunks[i + 1].meshletOffset;
+        for(std::size_t j = chunks[i].meshletOffset; j != end; ++j) {
+            const Meshlet& meshlet = meshlets[j];
+            CORRADE_VERIFY(meshlet.vertexCount <= 64);
+            CORRADE_VERIFY(meshlet.triangleCount <= 126);
+            for(UnsignedInt k = 0; k != meshlet.triangleCount*3; ++k)
+                expanded.push_back(vertices[chunks[i].vertexOffset + meshlet.vertexOffset + triangles[chunks[i].triangleOffset + meshlet.triangleOffset + k]]);
+        }
+    }
+    CORRADE_COMPARE(expanded, indices);
+}
+
+void StreamingTest::writeFailed() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(4, indices, positions);
+
+    std::istringstream indicesIn{toString(indices)}, positionsIn{toString(positions)};
+    std::ostringstream normalsOut;
+    normalsOut.setstate(std::ios::badbit);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!Streaming::generateSmoothNormals(indicesIn, indices.size(), positionsIn, positions.size(), normalsOut, NormalWeighting::Area, MemoryLimit));
+    CORRADE_COMPARE(out.str(), "MeshTools::Streaming::generateSmoothNormals(): can't write normals\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::StreamingTest)
@@ -81,4 +81,17 @@ void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween
     }
 }
 
+void SubdivideRemoveDuplicatesBenchmark::subdivideShared() {
+    QBENCHMARK {
+        Primitives::Icosphere<0> icosphere;
+
+        /* Subdivide 5 times, no duplicates are created */
+        MeshTools::subdivideShared(*icosphere.indices(), *icosphere.positions(0), interpolator);
+        MeshTools::subdivideShared(*icosphere.indices(), *icosphere.positions(0), interpolator);
+        MeshTools::subdivideShared(*icosphere.indices(), *icosphere.positions(0), interpolator);
+        MeshTools::subdivideShared(*icosphere.indices(), *icosphere.positions(0), interpolator);
+        MeshTools::subdivideShared(*icosphere.indices(), *icosphere.positions(0), interpolator);
+    }
+}
+
 }}}
@@ -38,6 +38,7 @@ class SubdivideRemoveDuplicatesBenchmark: public QObject {
         void subdivide();
         void subdivideAndRemoveDuplicatesMeshAfter();
         void subdivideAndRemoveDuplicatesMeshBetween();
+        void subdivideShared();
 
     private:
         static Magnum::Vector4 interpolator(const Magnum::Vector4& a, const Magnum::Vector4& b) {
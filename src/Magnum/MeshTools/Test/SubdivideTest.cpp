@@ -26,6 +26,7 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
 
@@ -37,6 +38,9 @@ class SubdivideTest: public TestSuite::Tester {
 
         void wrongIndexCount();
         void subdivide();
+        void subdivideShared();
+        void subdivideLoop();
+        void subdivideLoopBoundary();
 };
 
 namespace {
@@ -49,7 +53,10 @@ inline Vector1 interpolator(Vector1 a, Vector1 b) { return (a[0]+b[0])/2; }
 
 SubdivideTest::SubdivideTest() {
     addTests({&SubdivideTest::wrongIndexCount,
-              &SubdivideTest::subdivide});
+              &SubdivideTest::subdivide,
+              &SubdivideTest::subdivideShared,
+              &SubdivideTest::subdivideLoop,
+              &SubdivideTest::subdivideLoopBoundary});
 }
 
 void SubdivideTest::wrongIndexCount() {
@@ -59,7 +66,12 @@ void SubdivideTest::wrongIndexCount() {
     std::vector<Vector1> positions;
     std::vector<UnsignedInt> indices{0, 1};
     MeshTools::subdivide(indices, positions, interpolator);
-    CORRADE_COMPARE(ss.str(), "MeshTools::subdivide(): index count is not divisible by 3!\n");
+    MeshTools::subdivideShared(indices, positions, interpolator);
+    std::vector<Vector3> positions3;
+    MeshTools::subdivideLoop(indices, positions3);
+    CORRADE_COMPARE(ss.str(), "MeshTools::subdivide(): index count is not divisible by 3!\n"
+                              "MeshTools::subdivideShared(): index count is not divisible by 3!\n"
+                              "MeshTools::subdivideLoop(): index count is not divisible by 3!\n");
 }
 
 void SubdivideTest::subdivide() {
@@ -73,6 +85,60 @@ void SubdivideTest::subdivide() {
     CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 7, 8, 9, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 7, 9, 7, 2, 8, 9, 8, 3}));
 }
 
+void SubdivideTest::subdivideShared() {
+    std::vector<Vector1> positions{0, 2, 6, 8};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivideShared(indices, positions, interpolator);
+
+    /* Vertex in the middle of the shared edge is created only once */
+    CORRADE_VERIFY(positions == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 7, 5}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 5, 7, 8, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 5, 8, 5, 2, 7, 8, 7, 3}));
+
+    /* Nothing to remove */
+    std::vector<Vector1> unique{positions};
+    MeshTools::removeDuplicates(unique);
+    CORRADE_COMPARE(unique.size(), positions.size());
+}
+
+void SubdivideTest::subdivideLoop() {
+    /* Octahedron */
+    std::vector<Vector3> positions{
+        Vector3::xAxis(), Vector3::yAxis(), Vector3::zAxis(),
+        -Vector3::xAxis(), -Vector3::yAxis(), -Vector3::zAxis()};
+    std::vector<UnsignedInt> indices{
+        0, 1, 2, 1, 3, 2, 3, 4, 2, 4, 0, 2,
+        1, 0, 5, 3, 1, 5, 4, 3, 5, 0, 4, 5};
+    MeshTools::subdivideLoop(indices, positions);
+
+    CORRADE_COMPARE(indices.size(), 96);
+    CORRADE_COMPARE(positions.size(), 18);
+
+    /* Original vertices with valence 4 are smoothed using 3/32 weight for
+       each neighbor, edge vertex is 3/8 of the endpoints and 1/8 of the
+       opposite vertices */
+    CORRADE_COMPARE(positions[0], Vector3::xAxis()*(5.0f/8.0f));
+    CORRADE_COMPARE(positions[5], -Vector3::zAxis()*(5.0f/8.0f));
+    CORRADE_COMPARE(positions[6], (Vector3{3.0f/8.0f, 3.0f/8.0f, 0.0f}));
+
+    /* First face is replaced with the middle one */
+    CORRADE_COMPARE(indices[0], 6);
+    CORRADE_COMPARE(indices[1], 7);
+    CORRADE_COMPARE(indices[2], 8);
+    CORRADE_COMPARE(indices[24], 0);
+}
+
+void SubdivideTest::subdivideLoopBoundary() {
+    std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}, {0.0f, 4.0f, 0.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    MeshTools::subdivideLoop(indices, positions);
+
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{
+        {0.5f, 0.5f, 0.0f}, {3.0f, 0.5f, 0.0f}, {0.5f, 3.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 0.0f}, {0.0f, 2.0f, 0.0f}}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{3, 4, 5, 0, 3, 5, 3, 1, 4, 5, 4, 2}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideTest)
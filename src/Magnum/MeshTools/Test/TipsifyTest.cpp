@@ -36,6 +36,8 @@ class TipsifyTest: public TestSuite::Tester {
 
         void buildAdjacency();
         void tipsify();
+        void tipsifyClusters();
+        void tipsifyClustersUnreferencedFirstVertex();
 
     private:
         std::vector<UnsignedInt> indices;
@@ -82,7 +84,9 @@ TipsifyTest::TipsifyTest(): indices{
     16, 17, 18
 }, vertexCount(19) {
     addTests({&TipsifyTest::buildAdjacency,
-              &TipsifyTest::tipsify});
+              &TipsifyTest::tipsify,
+              &TipsifyTest::tipsifyClusters,
+              &TipsifyTest::tipsifyClustersUnreferencedFirstVertex});
 }
 
 void TipsifyTest::buildAdjacency() {
@@ -156,6 +160,30 @@ void TipsifyTest::tipsify() {
     }));
 }
 
+void TipsifyTest::tipsifyClusters() {
+    std::vector<UnsignedInt> clusters;
+    MeshTools::tipsify(indices, vertexCount, 3, clusters);
+
+    /* Cluster boundaries are on dead-ends, see above */
+    CORRADE_COMPARE(clusters, (std::vector<UnsignedInt>{
+        0, 51, 54
+    }));
+}
+
+void TipsifyTest::tipsifyClustersUnreferencedFirstVertex() {
+    /* Vertex 0 is not referenced, so the first fanning iteration doesn't
+       emit anything and the first cluster shouldn't be duplicated */
+    std::vector<UnsignedInt> indices{
+        1, 2, 3,
+        3, 2, 4
+    };
+    std::vector<UnsignedInt> clusters;
+    MeshTools::tipsify(indices, 5, 3, clusters);
+
+    CORRADE_COMPARE(indices.size(), 6);
+    CORRADE_COMPARE(clusters, std::vector<UnsignedInt>{0});
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TipsifyTest)
@@ -0,0 +1,80 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TransformBenchmark.h"
+
+#include <QtTest/QTest>
+
+#include "Magnum/MeshTools/Transform.h"
+
+QTEST_APPLESS_MAIN(Magnum::MeshTools::Test::TransformBenchmark)
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+namespace {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 0.5f})*Matrix4::rotationZ(Deg(35.0f));
+    const DualQuaternion dualQuaternion = DualQuaternion::translation({1.0f, -2.0f, 0.5f})*DualQuaternion::rotation(Deg(35.0f), Vector3::zAxis());
+}
+
+void TransformBenchmark::initTestCase() {
+    points.resize(1 << 20);
+    for(std::size_t i = 0; i != points.size(); ++i)
+        points[i] = Vector3(i%17, i%13, i%7);
+}
+
+void TransformBenchmark::transformPointsGeneric() {
+    /* The generic implementation, as in transformPointsInPlace() templated
+       on container type */
+    QBENCHMARK {
+        for(auto& point: points) point = matrix.transformPoint(point);
+    }
+}
+
+void TransformBenchmark::transformPointsBatch() {
+    QBENCHMARK {
+        MeshTools::transformPointsInPlace(matrix, points);
+    }
+}
+
+void TransformBenchmark::transformPointsStrided() {
+    /* Every other point */
+    QBENCHMARK {
+        MeshTools::transformPointsInPlace(matrix, {reinterpret_cast<char*>(points.data()), points.size()*sizeof(Vector3)}, 2*sizeof(Vector3), points.size()/2);
+    }
+}
+
+void TransformBenchmark::transformPointsDualQuaternionGeneric() {
+    QBENCHMARK {
+        for(auto& point: points) point = dualQuaternion.transformPointNormalized(point);
+    }
+}
+
+void TransformBenchmark::transformPointsDualQuaternionBatch() {
+    QBENCHMARK {
+        MeshTools::transformPointsInPlace(dualQuaternion, points);
+    }
+}
+
+}}}
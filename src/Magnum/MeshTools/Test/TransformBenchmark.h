@@ -0,0 +1,53 @@
+#ifndef Magnum_MeshTools_Test_TransformBenchmark_h
+#define Magnum_MeshTools_Test_TransformBenchmark_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <QtCore/QObject>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class TransformBenchmark: public QObject {
+    Q_OBJECT
+
+    private slots:
+        void initTestCase();
+
+        void transformPointsGeneric();
+        void transformPointsBatch();
+        void transformPointsStrided();
+        void transformPointsDualQuaternionGeneric();
+        void transformPointsDualQuaternionBatch();
+
+    private:
+        std::vector<Vector3> points;
+};
+
+}}}
+
+#endif
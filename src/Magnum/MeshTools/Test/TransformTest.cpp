@@ -24,6 +24,7 @@
 */
 
 #include <array>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
@@ -41,6 +42,12 @@ class TransformTest: public TestSuite::Tester {
 
         void transformPoints2D();
         void transformPoints3D();
+
+        void transformVectorsBatch();
+        void transformPointsBatch();
+        void transformStrided();
+        void transformStridedInvalid();
+        void transformNotNormalized();
 };
 
 TransformTest::TransformTest() {
@@ -48,7 +55,13 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformVectorsBatch,
+              &TransformTest::transformPointsBatch,
+              &TransformTest::transformStrided,
+              &TransformTest::transformStridedInvalid,
+              &TransformTest::transformNotNormalized});
 }
 
 /* GCC < 4.7 doesn't like constexpr here, don't know why */
@@ -126,6 +139,87 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+void TransformTest::transformVectorsBatch() {
+    const std::vector<Vector3> points{points3D.begin(), points3D.end()};
+    const std::vector<Vector3> expected{{3.0f, -4.0f, 34.0f}, {-2.5f, 15.0f, 1.5f}};
+
+    /* These use the non-templated overloads for std::vector. Rotating by
+       180 degrees, as the quaternion then converts to matrix exactly. */
+    std::vector<Vector3> matrix = MeshTools::transformVectors(Matrix4::scaling({-1.0f, -1.0f, 1.0f}), points);
+    std::vector<Vector3> quaternion = MeshTools::transformVectors(Quaternion{Vector3::zAxis(), 0.0f}, points);
+
+    CORRADE_COMPARE(matrix, expected);
+    CORRADE_COMPARE(quaternion, expected);
+}
+
+void TransformTest::transformPointsBatch() {
+    const std::vector<Vector3> points{points3D.begin(), points3D.end()};
+    const std::vector<Vector3> expected{{3.0f, -5.0f, 34.0f}, {-2.5f, 14.0f, 1.5f}};
+
+    std::vector<Vector3> matrix = MeshTools::transformPoints(
+        Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::scaling({-1.0f, -1.0f, 1.0f}), points);
+    std::vector<Vector3> quaternion = MeshTools::transformPoints(
+        DualQuaternion::translation(Vector3::yAxis(-1.0f))*DualQuaternion{Quaternion{Vector3::zAxis(), 0.0f}}, points);
+
+    CORRADE_COMPARE(matrix, expected);
+    CORRADE_COMPARE(quaternion, expected);
+}
+
+void TransformTest::transformStrided() {
+    /* Positions interleaved with normals, which shouldn't be touched */
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    } vertices[]{
+        {points3D[0], Vector3::zAxis()},
+        {points3D[1], Vector3::zAxis()}
+    };
+
+    MeshTools::transformPointsInPlace(
+        Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotationZ(Deg(90.0f)),
+        {reinterpret_cast<char*>(vertices), sizeof(vertices)}, sizeof(Vertex), 2);
+    CORRADE_COMPARE(vertices[0].position, points3DRotatedTranslated[0]);
+    CORRADE_COMPARE(vertices[1].position, points3DRotatedTranslated[1]);
+    CORRADE_COMPARE(vertices[0].normal, Vector3::zAxis());
+    CORRADE_COMPARE(vertices[1].normal, Vector3::zAxis());
+
+    /* Translation isn't applied to vectors */
+    MeshTools::transformVectorsInPlace(
+        Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotationX(Deg(90.0f)),
+        {reinterpret_cast<char*>(vertices) + sizeof(Vector3), sizeof(vertices) - sizeof(Vector3)}, sizeof(Vertex), 2);
+    CORRADE_COMPARE(vertices[0].normal, -Vector3::yAxis());
+    CORRADE_COMPARE(vertices[1].normal, -Vector3::yAxis());
+    CORRADE_COMPARE(vertices[0].position, points3DRotatedTranslated[0]);
+}
+
+void TransformTest::transformStridedInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Vector3 data[2];
+    MeshTools::transformPointsInPlace(Matrix4(), {reinterpret_cast<char*>(data), sizeof(data)}, 8, 2);
+    MeshTools::transformVectorsInPlace(Matrix4(), {reinterpret_cast<char*>(data), sizeof(data)}, 12, 3);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::transformPointsInPlace(): stride 8 is smaller than point size\n"
+        "MeshTools::transformVectorsInPlace(): the data buffer is too small, expected 36 but got 24\n");
+}
+
+void TransformTest::transformNotNormalized() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<Vector3> data{points3D.begin(), points3D.end()};
+    MeshTools::transformVectorsInPlace(Quaternion::rotation(Deg(90.0f), Vector3::zAxis())*2.0f, data);
+    MeshTools::transformPointsInPlace(DualQuaternion{Quaternion::rotation(Deg(90.0f), Vector3::zAxis())*2.0f}, data);
+
+    /* The data are not touched */
+    CORRADE_COMPARE(data[0], points3D[0]);
+    CORRADE_COMPARE(data[1], points3D[1]);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::transformVectorsInPlace(): quaternion must be normalized\n"
+        "MeshTools::transformPointsInPlace(): dual quaternion must be normalized\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
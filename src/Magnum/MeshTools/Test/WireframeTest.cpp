@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/Wireframe.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class WireframeTest: public TestSuite::Tester {
+    public:
+        explicit WireframeTest();
+
+        void vertexIndicesWrongIndexCount();
+        void vertexIndices();
+
+        void linesWrongIndexCount();
+        void lines();
+        void linesLarge();
+};
+
+WireframeTest::WireframeTest() {
+    addTests({&WireframeTest::vertexIndicesWrongIndexCount,
+              &WireframeTest::vertexIndices,
+
+              &WireframeTest::linesWrongIndexCount,
+              &WireframeTest::lines,
+              &WireframeTest::linesLarge});
+}
+
+void WireframeTest::vertexIndicesWrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshTools::wireframeVertexIndices({0, 1});
+    CORRADE_COMPARE(out.str(), "MeshTools::wireframeVertexIndices(): index count is not divisible by 3\n");
+}
+
+void WireframeTest::vertexIndices() {
+    CORRADE_COMPARE(MeshTools::wireframeVertexIndices({4, 2, 7, 7, 2, 1}),
+        (std::vector<Float>{0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f}));
+}
+
+void WireframeTest::linesWrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshTools::wireframeLines({0, 1});
+    CORRADE_COMPARE(out.str(), "MeshTools::wireframeLines(): index count is not divisible by 3\n");
+}
+
+void WireframeTest::lines() {
+    /* Two triangles sharing edge 1-2 in opposite direction, plus degenerate
+       triangle with edge 3-0 */
+    CORRADE_COMPARE(MeshTools::wireframeLines({
+        0, 1, 2,
+        2, 1, 3,
+        3, 0, 0
+    }), (std::vector<UnsignedInt>{
+        0, 1, 1, 2, 2, 0,
+        1, 3, 3, 2,
+        3, 0
+    }));
+}
+
+void WireframeTest::linesLarge() {
+    /* Grid of 100x100 quads, each split into two triangles */
+    constexpr UnsignedInt Size = 100;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt i = y*(Size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + Size + 2,
+                                       i, i + Size + 2, i + Size + 1});
+    }
+
+    /* Horizontal, vertical and diagonal edges */
+    CORRADE_COMPARE(MeshTools::wireframeLines(indices).size(),
+        2*(Size*(Size + 1)*2 + Size*Size));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::WireframeTest)
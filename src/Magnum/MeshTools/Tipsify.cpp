@@ -29,7 +29,7 @@
 
 namespace Magnum { namespace MeshTools { namespace Implementation {
 
-void Tipsify::operator()(std::size_t cacheSize) {
+void Tipsify::operator()(std::size_t cacheSize, std::vector<UnsignedInt>* const clusters) {
     /* Neighboring triangles for each vertex, per-vertex live triangle count */
     std::vector<UnsignedInt> liveTriangleCount, neighborPosition, neighbors;
     buildAdjacency(liveTriangleCount, neighborPosition, neighbors);
@@ -46,6 +46,12 @@ void Tipsify::operator()(std::size_t cacheSize) {
     std::vector<UnsignedInt> outputIndices;
     outputIndices.reserve(indices.size());
 
+    /* First cluster starts at the beginning */
+    if(clusters) {
+        clusters->clear();
+        if(!indices.empty()) clusters->push_back(0);
+    }
+
     /* Starting vertex for fanning, cursor */
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
@@ -121,6 +127,13 @@ void Tipsify::operator()(std::size_t cacheSize) {
                 fanningVertex = i;
                 break;
             }
+
+            /* Fanning continues from unrelated vertex, start new cluster.
+               Nothing might be emitted since the last one (e.g. if the
+               first vertex isn't referenced by any triangle), don't create
+               empty clusters in that case. */
+            if(clusters && fanningVertex != 0xFFFFFFFFu && outputIndices.size() != clusters->back())
+                clusters->push_back(outputIndices.size());
         }
     }
 
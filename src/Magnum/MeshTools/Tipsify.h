@@ -42,7 +42,7 @@ class MAGNUM_MESHTOOLS_EXPORT Tipsify {
     public:
         Tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount): indices(indices), vertexCount(vertexCount) {}
 
-        void operator()(std::size_t cacheSize);
+        void operator()(std::size_t cacheSize, std::vector<UnsignedInt>* clusters = nullptr);
 
         /**
          * @brief Build vertex-triangle adjacency
@@ -71,12 +71,31 @@ array for beter usage of post-transform vertex cache. Algorithm used:
 *Pedro V. Sander, Diego Nehab, and Joshua Barczak - Fast Triangle Reordering
 for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
 http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+@see @ref optimizeOverdraw()
 @todo Ability to compute vertex count automatically
 */
 inline void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize) {
     Implementation::Tipsify(indices, vertexCount)(cacheSize);
 }
 
+/**
+@brief %Tipsify the mesh and output cluster boundaries
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Post-transform vertex cache size
+@param[out] clusters    Offsets into @p indices where each cluster starts
+
+Same as @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t),
+but additionally fills @p clusters with positions of dead-ends in the output
+index array, i.e. places where the fanning restarted from unrelated vertex.
+Triangles between two consecutive offsets can be rendered in any order
+relative to other clusters without affecting vertex cache efficiency, which
+is exploited by @ref optimizeOverdraw(). First offset is always `0`.
+*/
+inline void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize, std::vector<UnsignedInt>& clusters) {
+    Implementation::Tipsify(indices, vertexCount)(cacheSize, &clusters);
+}
+
 }}
 
 #endif
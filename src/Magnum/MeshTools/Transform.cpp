@@ -0,0 +1,60 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Transform.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Batch.h"
+
+namespace Magnum { namespace MeshTools {
+
+void transformVectorsInPlace(const Matrix4& matrix, Containers::ArrayReference<char> data, const std::size_t stride, const std::size_t count) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3), "MeshTools::transformVectorsInPlace(): stride" << stride << "is smaller than vector size", );
+    CORRADE_ASSERT(!count || (count - 1)*stride + sizeof(Vector3) <= data.size(), "MeshTools::transformVectorsInPlace(): the data buffer is too small, expected" << (count - 1)*stride + sizeof(Vector3) << "but got" << data.size(), );
+
+    const Math::StridedArrayReference<Vector3> view{reinterpret_cast<Vector3*>(data.begin()), count, stride};
+    Math::transformVectors(matrix, view, view);
+}
+
+void transformVectorsInPlace(const Quaternion& normalizedQuaternion, Containers::ArrayReference<char> data, const std::size_t stride, const std::size_t count) {
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(), "MeshTools::transformVectorsInPlace(): quaternion must be normalized", );
+    transformVectorsInPlace(Matrix4::from(normalizedQuaternion.toMatrix(), {}), data, stride, count);
+}
+
+void transformPointsInPlace(const Matrix4& matrix, Containers::ArrayReference<char> data, const std::size_t stride, const std::size_t count) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3), "MeshTools::transformPointsInPlace(): stride" << stride << "is smaller than point size", );
+    CORRADE_ASSERT(!count || (count - 1)*stride + sizeof(Vector3) <= data.size(), "MeshTools::transformPointsInPlace(): the data buffer is too small, expected" << (count - 1)*stride + sizeof(Vector3) << "but got" << data.size(), );
+
+    const Math::StridedArrayReference<Vector3> view{reinterpret_cast<Vector3*>(data.begin()), count, stride};
+    Math::transformPoints(matrix, view, view);
+}
+
+void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, Containers::ArrayReference<char> data, const std::size_t stride, const std::size_t count) {
+    CORRADE_ASSERT(normalizedDualQuaternion.isNormalized(), "MeshTools::transformPointsInPlace(): dual quaternion must be normalized", );
+    transformPointsInPlace(normalizedDualQuaternion.toMatrix(), data, stride, count);
+}
+
+}}
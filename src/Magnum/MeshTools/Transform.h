@@ -29,8 +29,13 @@
  * @brief Function Magnum::MeshTools::transformVectorsInPlace(), Magnum::MeshTools::transformVectors(), Magnum::MeshTools::transformPointsInPlace(), Magnum::MeshTools::transformPoints()
  */
 
+#include <vector>
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Magnum.h"
 #include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/DualComplex.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -76,6 +81,50 @@ template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>&
     for(auto& vector: vectors) vector = matrix.transformVector(vector);
 }
 
+/**
+@brief Transform strided vectors in-place using given matrix
+@param matrix   Transformation matrix
+@param data     Data containing the vectors
+@param stride   Distance between two consecutive vectors in bytes
+@param count    Vector count
+
+Batch variant of @ref transformVectorsInPlace() for @ref Vector3 data with
+arbitrary stride, e.g. normals in interleaved vertex data, so they don't need
+to be extracted first. The matrix is kept in registers for the whole loop
+and the loop doesn't construct any temporaries, which makes it faster than
+the generic implementation. Only the upper-left 3x3 part of the matrix is
+used.
+
+@attention The @p data must be large enough to contain @p count items with
+    given @p stride, the @p stride must be at least `sizeof(Vector3)` and the
+    data must be four-byte aligned.
+@see @ref transformPointsInPlace(const Matrix4&, Containers::ArrayReference<char>, std::size_t, std::size_t)
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Matrix4& matrix, Containers::ArrayReference<char> data, std::size_t stride, std::size_t count);
+
+/**
+@overload
+
+The quaternion is converted to rotation matrix first, thus it has the same
+requirements as in the generic @ref transformVectorsInPlace().
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Quaternion& normalizedQuaternion, Containers::ArrayReference<char> data, std::size_t stride, std::size_t count);
+
+/**
+@brief Transform vectors in-place using given matrix
+
+Overload of the generic @ref transformVectorsInPlace() for `std::vector`,
+uses the batch variant above.
+*/
+inline void transformVectorsInPlace(const Matrix4& matrix, std::vector<Vector3>& vectors) {
+    transformVectorsInPlace(matrix, {reinterpret_cast<char*>(vectors.data()), vectors.size()*sizeof(Vector3)}, sizeof(Vector3), vectors.size());
+}
+
+/** @overload */
+inline void transformVectorsInPlace(const Quaternion& normalizedQuaternion, std::vector<Vector3>& vectors) {
+    transformVectorsInPlace(normalizedQuaternion, {reinterpret_cast<char*>(vectors.data()), vectors.size()*sizeof(Vector3)}, sizeof(Vector3), vectors.size());
+}
+
 /**
 @brief Transform vectors using given transformation
 
@@ -130,6 +179,44 @@ template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& m
     for(auto& point: points) point = matrix.transformPoint(point);
 }
 
+/**
+@brief Transform strided points in-place using given matrix
+@param matrix   Transformation matrix
+@param data     Data containing the points
+@param stride   Distance between two consecutive points in bytes
+@param count    Point count
+
+Batch variant of @ref transformPointsInPlace() for @ref Vector3 data with
+arbitrary stride, e.g. positions in interleaved vertex data. See
+@ref transformVectorsInPlace(const Matrix4&, Containers::ArrayReference<char>, std::size_t, std::size_t)
+for more information. Only the upper 3x4 part of the matrix is used, which
+gives the same result as @ref Matrix4::transformPoint().
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const Matrix4& matrix, Containers::ArrayReference<char> data, std::size_t stride, std::size_t count);
+
+/**
+@overload
+
+The dual quaternion is converted to transformation matrix first, thus it
+has the same requirements as in the generic @ref transformPointsInPlace().
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, Containers::ArrayReference<char> data, std::size_t stride, std::size_t count);
+
+/**
+@brief Transform points in-place using given matrix
+
+Overload of the generic @ref transformPointsInPlace() for `std::vector`,
+uses the batch variant above.
+*/
+inline void transformPointsInPlace(const Matrix4& matrix, std::vector<Vector3>& points) {
+    transformPointsInPlace(matrix, {reinterpret_cast<char*>(points.data()), points.size()*sizeof(Vector3)}, sizeof(Vector3), points.size());
+}
+
+/** @overload */
+inline void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, std::vector<Vector3>& points) {
+    transformPointsInPlace(normalizedDualQuaternion, {reinterpret_cast<char*>(points.data()), points.size()*sizeof(Vector3)}, sizeof(Vector3), points.size());
+}
+
 /**
 @brief Transform points using given transformation
 
@@ -0,0 +1,85 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Wireframe.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/MeshTools/Implementation/Hash.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::vector<Float> wireframeVertexIndices(const std::vector<UnsignedInt>& indices) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::wireframeVertexIndices(): index count is not divisible by 3", {});
+
+    std::vector<Float> out(indices.size());
+    for(std::size_t i = 0; i != out.size(); i += 3) {
+        out[i + 1] = 1.0f;
+        out[i + 2] = 2.0f;
+    }
+    return out;
+}
+
+std::vector<UnsignedInt> wireframeLines(const std::vector<UnsignedInt>& indices) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::wireframeLines(): index count is not divisible by 3", {});
+
+    /* Open-addressing table with linear probing, containing edges as pairs
+       of (smaller, larger) index packed into 64 bits. Power-of-two size with
+       load factor at most 0.5, as if each edge was unique. The key can't be
+       all ones, because the smaller index is always less than the larger. */
+    std::size_t capacity = 16;
+    while(capacity < indices.size()*2) capacity *= 2;
+    const std::size_t mask = capacity - 1;
+    constexpr UnsignedLong Empty = ~UnsignedLong{};
+    std::vector<UnsignedLong> table(capacity, Empty);
+
+    /* Closed manifold mesh has 1.5 edges per triangle, reserve for that */
+    std::vector<UnsignedInt> out;
+    out.reserve(indices.size());
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        for(std::size_t j = 0; j != 3; ++j) {
+            UnsignedInt a = indices[i + j];
+            UnsignedInt b = indices[i + (j + 1) % 3];
+
+            /* Degenerate edges are not drawn */
+            if(a == b) continue;
+            if(a > b) std::swap(a, b);
+
+            const UnsignedLong key = UnsignedLong(a) | (UnsignedLong(b) << 32);
+            std::size_t slot = Implementation::mix(key) & mask;
+            while(table[slot] != Empty && table[slot] != key)
+                slot = (slot + 1) & mask;
+            if(table[slot] == key) continue;
+
+            table[slot] = key;
+            out.push_back(indices[i + j]);
+            out.push_back(indices[i + (j + 1) % 3]);
+        }
+    }
+
+    return out;
+}
+
+}}
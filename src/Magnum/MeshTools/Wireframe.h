@@ -0,0 +1,92 @@
+#ifndef Magnum_MeshTools_Wireframe_h
+#define Magnum_MeshTools_Wireframe_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::wireframeVertexIndices(), @ref Magnum::MeshTools::wireframeLines()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Vertex index attribute for wireframe rendering without geometry shader
+@param indices      Triangle index array
+@return Vertex index for each vertex of de-indexed mesh
+
+Produces data for @ref Shaders::MeshVisualizer::VertexIndex attribute, which
+is needed for wireframe rendering with @ref Shaders::MeshVisualizer::Flag::NoGeometryShader
+(e.g. on OpenGL ES 2.0 or where geometry shaders are slow). The mesh needs
+to be de-indexed with @ref duplicate(), so each triangle has its own three
+vertices. The shader uses only the index modulo `3`, so the values repeat
+`0`, `1`, `2` for each triangle and thus don't lose precision even for
+meshes with more than 2<sup>24</sup> vertices. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<Vector3> wireframePositions = MeshTools::duplicate(indices, positions);
+std::vector<Float> vertexIndices = MeshTools::wireframeVertexIndices(indices);
+
+Buffer vertexBuffer;
+vertexBuffer.setData(MeshTools::interleave(wireframePositions, vertexIndices), BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.setPrimitive(MeshPrimitive::Triangles)
+    .setCount(wireframePositions.size())
+    .addVertexBuffer(vertexBuffer, 0, Shaders::MeshVisualizer::Position(),
+        Shaders::MeshVisualizer::VertexIndex());
+@endcode
+
+@attention Index count must be divisible by 3.
+@see @ref wireframeLines()
+*/
+std::vector<Float> MAGNUM_MESHTOOLS_EXPORT wireframeVertexIndices(const std::vector<UnsignedInt>& indices);
+
+/**
+@brief Unique edges of triangle mesh
+@param indices      Triangle index array
+@return Line index array
+
+Extracts each edge of the mesh only once, regardless of its direction and
+number of triangles sharing it, in order of first occurrence. The result
+can be used as index buffer for @ref MeshPrimitive::Lines with the original
+vertex data, which is the cheapest way to draw wireframe if line width and
+antialiasing of the shader-based wireframe aren't needed. Edges are
+deduplicated in linear time using open-addressing hash table.
+
+@attention Index count must be divisible by 3.
+@see @ref wireframeVertexIndices()
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT wireframeLines(const std::vector<UnsignedInt>& indices);
+
+}}
+
+#endif
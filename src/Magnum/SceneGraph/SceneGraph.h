@@ -192,6 +192,9 @@ typedef BasicRigidMatrixTransformation3D<Float> RigidMatrixTransformation3D;
 
 template<class Transformation> class Scene;
 
+template<class> class Track;
+enum class TrackInterpolation: UnsignedByte;
+
 template<UnsignedInt, class T, class = T> class TranslationTransformation;
 #ifndef CORRADE_GCC46_COMPATIBILITY
 template<class T, class TranslationType = T> using BasicTranslationTransformation2D = TranslationTransformation<2, T, TranslationType>;
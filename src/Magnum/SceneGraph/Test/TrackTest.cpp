@@ -0,0 +1,209 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Track.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+class TrackTest: public TestSuite::Tester {
+    public:
+        TrackTest();
+
+        void construct();
+        void constructWrongSize();
+        void constructNotSorted();
+
+        void clamp();
+        void linear();
+        void constant();
+        void cursor();
+        void cursorBackwards();
+        void quaternion();
+        void quaternionShortestPath();
+        void dualQuaternion();
+
+        void sampleTracks();
+};
+
+TrackTest::TrackTest() {
+    addTests({&TrackTest::construct,
+              &TrackTest::constructWrongSize,
+              &TrackTest::constructNotSorted,
+
+              &TrackTest::clamp,
+              &TrackTest::linear,
+              &TrackTest::constant,
+              &TrackTest::cursor,
+              &TrackTest::cursorBackwards,
+              &TrackTest::quaternion,
+              &TrackTest::quaternionShortestPath,
+              &TrackTest::dualQuaternion,
+
+              &TrackTest::sampleTracks});
+}
+
+void TrackTest::construct() {
+    const TranslationTrack track{{1.0f, 2.5f, 4.0f}, {{}, Vector3::xAxis(), Vector3::yAxis()}, TrackInterpolation::Constant};
+    CORRADE_COMPARE(track.size(), 3);
+    CORRADE_COMPARE(track.begin(), 1.0f);
+    CORRADE_COMPARE(track.end(), 4.0f);
+    CORRADE_COMPARE(track.duration(), 3.0f);
+    CORRADE_VERIFY(track.interpolation() == TrackInterpolation::Constant);
+    CORRADE_COMPARE(track.times(), (std::vector<Float>{1.0f, 2.5f, 4.0f}));
+    CORRADE_COMPARE(track.values()[1], Vector3::xAxis());
+}
+
+void TrackTest::constructWrongSize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    TranslationTrack{{1.0f, 2.0f}, {Vector3()}};
+    TranslationTrack{{}, {}};
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Track: expected non-empty and equally sized time and value arrays\n"
+        "SceneGraph::Track: expected non-empty and equally sized time and value arrays\n");
+}
+
+void TrackTest::constructNotSorted() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    TranslationTrack{{1.0f, 0.5f}, {Vector3(), Vector3()}};
+    CORRADE_COMPARE(out.str(), "SceneGraph::Track: keyframe times are not sorted\n");
+}
+
+void TrackTest::clamp() {
+    const TranslationTrack track{{1.0f, 2.0f}, {Vector3::xAxis(), Vector3::yAxis()}};
+    std::size_t cursor = 0;
+    CORRADE_COMPARE(track.at(-5.0f, cursor), Vector3::xAxis());
+    CORRADE_COMPARE(cursor, 0);
+    CORRADE_COMPARE(track.at(7.0f, cursor), Vector3::yAxis());
+    CORRADE_COMPARE(cursor, 1);
+
+    /* Single keyframe */
+    const TranslationTrack single{{1.0f}, {Vector3::zAxis()}};
+    CORRADE_COMPARE(single.at(0.0f), Vector3::zAxis());
+    CORRADE_COMPARE(single.at(1.0f), Vector3::zAxis());
+    CORRADE_COMPARE(single.at(2.0f), Vector3::zAxis());
+}
+
+void TrackTest::linear() {
+    const TranslationTrack track{{0.0f, 1.0f, 3.0f}, {{}, {2.0f, 0.0f, 0.0f}, {2.0f, 4.0f, 0.0f}}};
+    CORRADE_COMPARE(track.at(0.5f), Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(track.at(1.0f), Vector3(2.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(track.at(2.5f), Vector3(2.0f, 3.0f, 0.0f));
+}
+
+void TrackTest::constant() {
+    const TranslationTrack track{{0.0f, 1.0f, 3.0f}, {{}, {2.0f, 0.0f, 0.0f}, {2.0f, 4.0f, 0.0f}}, TrackInterpolation::Constant};
+    CORRADE_COMPARE(track.at(0.5f), Vector3());
+    CORRADE_COMPARE(track.at(1.0f), Vector3(2.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(track.at(2.9f), Vector3(2.0f, 0.0f, 0.0f));
+}
+
+void TrackTest::cursor() {
+    const Track<Vector3> track{{0.0f, 1.0f, 2.0f, 3.0f, 4.0f},
+        {{}, Vector3(1.0f), Vector3(2.0f), Vector3(3.0f), Vector3(4.0f)}};
+
+    std::size_t cursor = 0;
+    CORRADE_COMPARE(track.at(0.5f, cursor), Vector3(0.5f));
+    CORRADE_COMPARE(cursor, 0);
+    CORRADE_COMPARE(track.at(1.5f, cursor), Vector3(1.5f));
+    CORRADE_COMPARE(cursor, 1);
+
+    /* Skipping more keyframes */
+    CORRADE_COMPARE(track.at(3.25f, cursor), Vector3(3.25f));
+    CORRADE_COMPARE(cursor, 3);
+
+    /* Invalid cursor falls back to binary search */
+    cursor = 1000;
+    CORRADE_COMPARE(track.at(2.5f, cursor), Vector3(2.5f));
+    CORRADE_COMPARE(cursor, 2);
+}
+
+void TrackTest::cursorBackwards() {
+    const Track<Vector3> track{{0.0f, 1.0f, 2.0f, 3.0f, 4.0f},
+        {{}, Vector3(1.0f), Vector3(2.0f), Vector3(3.0f), Vector3(4.0f)}};
+
+    std::size_t cursor = 3;
+    CORRADE_COMPARE(track.at(1.5f, cursor), Vector3(1.5f));
+    CORRADE_COMPARE(cursor, 1);
+
+    /* Going back into the range after clamping at the end */
+    CORRADE_COMPARE(track.at(10.0f, cursor), Vector3(4.0f));
+    CORRADE_COMPARE(track.at(3.5f, cursor), Vector3(3.5f));
+    CORRADE_COMPARE(cursor, 3);
+}
+
+void TrackTest::quaternion() {
+    const RotationTrack track{{0.0f, 1.0f, 2.0f}, {
+        Quaternion(),
+        Quaternion(),
+        Quaternion::rotation(Deg(90.0f), Vector3::zAxis())}};
+
+    /* Identical keyframes shouldn't produce NaNs */
+    CORRADE_COMPARE(track.at(0.5f), Quaternion());
+    CORRADE_COMPARE(track.at(1.5f), Quaternion::rotation(Deg(45.0f), Vector3::zAxis()));
+    CORRADE_COMPARE(track.at(1.75f), Quaternion::rotation(Deg(67.5f), Vector3::zAxis()));
+}
+
+void TrackTest::quaternionShortestPath() {
+    /* 270 degrees rotation is the same as -90 degrees */
+    const RotationTrack track{{0.0f, 1.0f}, {
+        Quaternion(),
+        Quaternion::rotation(Deg(270.0f), Vector3::zAxis())}};
+    CORRADE_COMPARE(track.at(0.5f), Quaternion::rotation(Deg(-45.0f), Vector3::zAxis()));
+}
+
+void TrackTest::dualQuaternion() {
+    const DualQuaternionTrack track{{0.0f, 2.0f}, {
+        DualQuaternion::translation({2.0f, 0.0f, 0.0f}),
+        DualQuaternion::translation({4.0f, 2.0f, 0.0f})}};
+
+    const DualQuaternion value = track.at(0.5f);
+    CORRADE_VERIFY(value.isNormalized());
+    CORRADE_COMPARE(value.translation(), Vector3(2.5f, 0.5f, 0.0f));
+}
+
+void TrackTest::sampleTracks() {
+    const std::vector<TranslationTrack> tracks{
+        TranslationTrack{{0.0f, 1.0f}, {{}, Vector3(2.0f)}},
+        TranslationTrack{{1.0f, 2.0f}, {{}, Vector3(2.0f)}},
+        TranslationTrack{{0.0f, 0.5f, 1.0f}, {{}, Vector3(1.0f), Vector3(4.0f)}}
+    };
+
+    std::vector<std::size_t> cursors;
+    std::vector<Vector3> out;
+    SceneGraph::sampleTracks(tracks, 0.75f, cursors, out);
+    CORRADE_COMPARE(out, (std::vector<Vector3>{Vector3(1.5f), Vector3(), Vector3(2.5f)}));
+    CORRADE_COMPARE(cursors, (std::vector<std::size_t>{0, 0, 1}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackTest)
@@ -0,0 +1,244 @@
+#ifndef Magnum_SceneGraph_Track_h
+#define Magnum_SceneGraph_Track_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::Track, enum @ref Magnum::SceneGraph::TrackInterpolation, function @ref Magnum::SceneGraph::sampleTracks(), typedef @ref Magnum::SceneGraph::TranslationTrack, @ref Magnum::SceneGraph::RotationTrack, @ref Magnum::SceneGraph::DualQuaternionTrack
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Track interpolation
+
+@see @ref Track::interpolation()
+*/
+enum class TrackInterpolation: UnsignedByte {
+    /** Value of the previous keyframe is used until the next keyframe */
+    Constant,
+
+    /**
+     * Linear interpolation between keyframes. Vectors are interpolated using
+     * @ref Math::lerp(), quaternions using spherical linear interpolation
+     * along the shortest path and dual quaternions using normalized linear
+     * interpolation along the shortest path.
+     */
+    Linear
+};
+
+namespace Implementation {
+    template<class T> inline T interpolateKeyframes(const T& a, const T& b, Float t) {
+        return Math::lerp(a, b, t);
+    }
+
+    template<> inline Quaternion interpolateKeyframes(const Quaternion& a, const Quaternion& b, const Float t) {
+        /* Take the shortest path, fall back to linear interpolation for
+           (nearly) identical rotations where slerp would divide by zero */
+        const Float cosAngle = Quaternion::dot(a, b);
+        const Quaternion target = cosAngle < 0.0f ? b*-1.0f : b;
+        if(std::abs(cosAngle) > 1.0f - Math::TypeTraits<Float>::epsilon())
+            return ((1.0f - t)*a + t*target).normalized();
+
+        const Float angle = std::acos(std::abs(cosAngle));
+        return (std::sin((1.0f - t)*angle)*a + std::sin(t*angle)*target)/std::sin(angle);
+    }
+
+    template<> inline DualQuaternion interpolateKeyframes(const DualQuaternion& a, const DualQuaternion& b, const Float t) {
+        const Float sign = Quaternion::dot(a.real(), b.real()) < 0.0f ? -1.0f : 1.0f;
+        Quaternion real = (1.0f - t)*a.real() + (t*sign)*b.real();
+        Quaternion dual = (1.0f - t)*a.dual() + (t*sign)*b.dual();
+        const Float length = real.length();
+        return {real/length, dual/length};
+    }
+}
+
+/**
+@brief Keyframe track
+
+Stores keyframe times and values in two separate contiguous arrays, so the
+time lookup touches only the times. Values between keyframes are computed
+according to @ref interpolation(), values outside of the keyframe range are
+clamped to the first or last keyframe.
+
+@section Track-cursor Cached cursor
+
+Each sampling function has an overload which takes index of keyframe used
+in previous call. If the time doesn't go backwards, the keyframe is found by
+advancing the cursor from there, which is amortized @f$ \mathcal{O}(1) @f$
+for normal playback, otherwise it falls back to binary search. The cursor is
+not part of the track, so one track can be shared by many players, each
+having its own cursor. Example usage in @ref Animable::animationStep():
+@code
+SceneGraph::RotationTrack track{{0.0f, 1.0f, 2.0f}, {a, b, c}};
+std::size_t cursor = 0;
+
+// ...
+
+void AnimableObject::animationStep(Float time, Float) {
+    setRotation(track.at(time, cursor));
+}
+@endcode
+
+Use @ref sampleTracks() for sampling many tracks at once.
+
+@see @ref TranslationTrack, @ref RotationTrack, @ref DualQuaternionTrack
+*/
+template<class T> class Track {
+    public:
+        /** @brief Value type */
+        typedef T ValueType;
+
+        /**
+         * @brief Constructor
+         * @param times         Keyframe times, sorted ascending
+         * @param values        Keyframe values
+         * @param interpolation Interpolation between keyframes
+         *
+         * Both arrays must be non-empty and have the same size. If the
+         * values are quaternions or dual quaternions, they are expected to
+         * be normalized.
+         */
+        explicit Track(std::vector<Float> times, std::vector<T> values, TrackInterpolation interpolation = TrackInterpolation::Linear): _times(std::move(times)), _values(std::move(values)), _interpolation(interpolation) {
+            CORRADE_ASSERT(!_times.empty() && _times.size() == _values.size(),
+                "SceneGraph::Track: expected non-empty and equally sized time and value arrays", );
+            CORRADE_ASSERT(std::is_sorted(_times.begin(), _times.end()),
+                "SceneGraph::Track: keyframe times are not sorted", );
+        }
+
+        /** @brief Keyframe times */
+        const std::vector<Float>& times() const { return _times; }
+
+        /** @brief Keyframe values */
+        const std::vector<T>& values() const { return _values; }
+
+        /** @brief Interpolation */
+        TrackInterpolation interpolation() const { return _interpolation; }
+
+        /** @brief Keyframe count */
+        std::size_t size() const { return _times.size(); }
+
+        /** @brief Time of the first keyframe */
+        Float begin() const { return _times.front(); }
+
+        /** @brief Time of the last keyframe */
+        Float end() const { return _times.back(); }
+
+        /** @brief Duration */
+        Float duration() const { return _times.back() - _times.front(); }
+
+        /**
+         * @brief Value at given time
+         * @param time      Time
+         * @param cursor    Keyframe index from previous call, updated to
+         *      current keyframe
+         *
+         * See @ref Track-cursor "class documentation" for more information.
+         * The cursor can be initialized to `0`.
+         */
+        T at(Float time, std::size_t& cursor) const;
+
+        /**
+         * @brief Value at given time
+         *
+         * Finds the keyframe using binary search. Prefer
+         * @ref at(Float, std::size_t&) const for playback.
+         */
+        T at(Float time) const {
+            std::size_t cursor = 0;
+            return at(time, cursor);
+        }
+
+    private:
+        std::vector<Float> _times;
+        std::vector<T> _values;
+        TrackInterpolation _interpolation;
+};
+
+template<class T> T Track<T>::at(const Float time, std::size_t& cursor) const {
+    /* Clamp outside of the range */
+    if(time <= _times.front()) {
+        cursor = 0;
+        return _values.front();
+    }
+    if(time >= _times.back()) {
+        cursor = _times.size() - 1;
+        return _values.back();
+    }
+
+    /* Find keyframe i with times[i] <= time < times[i + 1]. Walk forward from
+       the cursor if the time didn't go back, otherwise binary search. */
+    if(cursor < _times.size() && _times[cursor] <= time) {
+        while(_times[cursor + 1] <= time) ++cursor;
+    } else cursor = std::upper_bound(_times.begin(), _times.end(), time) - _times.begin() - 1;
+
+    if(_interpolation == TrackInterpolation::Constant) return _values[cursor];
+
+    const Float t = (time - _times[cursor])/(_times[cursor + 1] - _times[cursor]);
+    return Implementation::interpolateKeyframes(_values[cursor], _values[cursor + 1], t);
+}
+
+/**
+@brief Sample many tracks at once
+@param[in] tracks       Tracks
+@param[in] time         Time
+@param[in,out] cursors  Cursor for each track
+@param[out] out         Sampled value for each track
+
+Samples all tracks at the same time into contiguous array, using
+@ref Track::at(Float, std::size_t&) const. The @p cursors array is resized
+to track count with zero-initialized new elements if needed, so it can be
+empty initially. The output array is resized to track count and can be
+reused between frames to avoid reallocations.
+*/
+template<class T> void sampleTracks(const std::vector<Track<T>>& tracks, const Float time, std::vector<std::size_t>& cursors, std::vector<T>& out) {
+    cursors.resize(tracks.size());
+    out.resize(tracks.size());
+    for(std::size_t i = 0; i != tracks.size(); ++i)
+        out[i] = tracks[i].at(time, cursors[i]);
+}
+
+/** @brief Translation track */
+typedef Track<Vector3> TranslationTrack;
+
+/** @brief Rotation track */
+typedef Track<Quaternion> RotationTrack;
+
+/** @brief Rigid transformation track */
+typedef Track<DualQuaternion> DualQuaternionTrack;
+
+}}
+
+#endif
@@ -79,6 +79,16 @@ template<UnsignedInt dimensions> struct Generic {
      * Defined only in 3D.
      */
     typedef AbstractShaderProgram::Attribute<2, Vector3> Normal;
+
+    /**
+     * @brief Packed vertex normal
+     *
+     * Alternative to @ref Normal with the same location, allowing to use
+     * packed formats such as @ref MeshTools::quantizeNormalsPacked()
+     * output, which are available only for four-component attributes. The
+     * fourth component is ignored by the shaders. Defined only in 3D.
+     */
+    typedef AbstractShaderProgram::Attribute<2, Vector4> PackedNormal;
 };
 #endif
 
@@ -100,6 +110,7 @@ template<> struct Generic<2>: BaseGeneric {
 template<> struct Generic<3>: BaseGeneric {
     typedef AbstractShaderProgram::Attribute<0, Vector3> Position;
     typedef AbstractShaderProgram::Attribute<2, Vector3> Normal;
+    typedef AbstractShaderProgram::Attribute<2, Vector4> PackedNormal;
 };
 #endif
 
@@ -58,7 +58,10 @@ If you don't have geometry shaders, you need to set @ref Flag::NoGeometryShader
 (it's enabled by default in OpenGL ES) and use only **non-indexed** triangle
 meshes (see @ref MeshTools::duplicate() for possible solution). Additionaly, if
 you have OpenGL < 3.1 or OpenGL ES 2.0, you need to provide also
-@ref VertexIndex attribute.
+@ref VertexIndex attribute, which can be generated using
+@ref MeshTools::wireframeVertexIndices(). If you don't need wide or
+antialiased lines, @ref MeshTools::wireframeLines() can be used to draw the
+wireframe as plain line mesh instead.
 
 @requires_es_extension %Extension @extension{OES,standard_derivatives} for
     wireframe rendering.
@@ -25,6 +25,7 @@
 
 #cmakedefine MAGNUM_BUILD_DEPRECATED
 #cmakedefine MAGNUM_BUILD_STATIC
+#cmakedefine MAGNUM_MATH_SIMD
 #cmakedefine MAGNUM_TARGET_GLES
 #cmakedefine MAGNUM_TARGET_GLES2
 #cmakedefine MAGNUM_TARGET_GLES3